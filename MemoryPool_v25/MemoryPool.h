@@ -23,8 +23,7 @@
 #define ASSUME_ALIGNED(ptr, align) __assume((reinterpret_cast<uintptr_t>(ptr) & ((align) - 1)) == 0)
 
 // Branch prediction Ʈ (MSVC)
-#define LIKELY(x) (__builtin_expect(!!(x), 1))
-#define UNLIKELY(x) (__builtin_expect(!!(x), 0))
+// ũ  C++20 [[likely]] / [[unlikely]] Ӽ б⸶   (Ϸ б )
 
 // Prefetch Ÿ
 #define PREFETCH_DISTANCE 4
@@ -215,6 +214,23 @@ public:
     FORCE_INLINE T* Alloc(Args&&... args)
     {
         T* RESTRICT ptr = AllocRaw();
+        if (ptr == nullptr) [[unlikely]]
+        {
+            throw std::bad_alloc();
+        }
+        new (ptr) T(std::forward<Args>(args)...);
+        return ptr;
+    }
+
+    // Alloc   Ҵ     nullptr ȯ (ܸ  ʴ ȣڿ)
+    template<typename... Args>
+    FORCE_INLINE T* TryAlloc(Args&&... args)
+    {
+        T* RESTRICT ptr = AllocRaw();
+        if (ptr == nullptr) [[unlikely]]
+        {
+            return nullptr;
+        }
         new (ptr) T(std::forward<Args>(args)...);
         return ptr;
     }
@@ -227,7 +243,7 @@ public:
 
     FORCE_INLINE void Free(T* RESTRICT ptr)
     {
-        if (LIKELY(ptr != nullptr))
+        if (ptr != nullptr) [[likely]]
         {
             ptr->~T();
             FreeRaw(ptr);
@@ -251,14 +267,14 @@ private:
         
         // [1] Ultra Hot Path: hotHead  ȯ (~3 cycles)
         Node* node = cache->hotHead;
-        if (LIKELY(node != nullptr))
+        if (node != nullptr) [[likely]]
         {
             cache->hotHead = node->next;
             cache->hotCount--;
             
             // Aggressive prefetch (2ܰ )
             Node* prefetch1 = cache->hotHead;
-            if (LIKELY(prefetch1 != nullptr))
+            if (prefetch1 != nullptr) [[likely]]
             {
                 _mm_prefetch(reinterpret_cast<const char*>(prefetch1), _MM_HINT_T0);
                 Node* prefetch2 = prefetch1->next;
@@ -272,7 +288,7 @@ private:
         }
 
         // [2] Cold Path: coldHead hotHead ̵
-        if (LIKELY(cache->coldHead != nullptr))
+        if (cache->coldHead != nullptr) [[likely]]
         {
             PromoteColdToHot(cache);
             
@@ -298,7 +314,7 @@ private:
         cache->hotCount++;
 
         // Lazy flush (ſ 幮 )
-        if (UNLIKELY(cache->hotCount > TLS_CACHE_MAX))
+        if (cache->hotCount > TLS_CACHE_MAX) [[unlikely]]
         {
             FlushHotToCold(cache);
         }
@@ -313,7 +329,7 @@ private:
         // TLS ȸ ̹ ſ  ( )
         ThreadCache* cache = static_cast<ThreadCache*>(TlsGetValue(m_tlsIndex));
         
-        if (UNLIKELY(cache == nullptr))
+        if (cache == nullptr) [[unlikely]]
         {
             cache = CreateThreadCache();
         }
@@ -396,8 +412,11 @@ private:
             return reinterpret_cast<T*>(node);
         }
 
-        //   Ҵ
-        AllocateNewBlock(cache);
+        //   Ҵ (  nullptr - Alloc bad_alloc, TryAlloc nullptr )
+        if (!AllocateNewBlock(cache))
+        {
+            return nullptr;
+        }
         
         Node* node = cache->hotHead;
         cache->hotHead = node->next;
@@ -561,7 +580,7 @@ private:
     //  Ҵ - Large Page 
     // ========================================================================
     
-    void AllocateNewBlock(ThreadCache* RESTRICT cache)
+    bool AllocateNewBlock(ThreadCache* RESTRICT cache)
     {
         const size_t blockDataSize = ALIGNED_NODE_SIZE * BLOCK_ALLOC_COUNT;
         const size_t totalSize = sizeof(Block) + blockDataSize;
@@ -605,7 +624,7 @@ private:
         
         if (block == nullptr)
         {
-            throw std::bad_alloc();
+            return false;
         }
 
         block->size = totalSize;
@@ -644,6 +663,7 @@ private:
 
         // Prefetch
         _mm_prefetch(reinterpret_cast<const char*>(cache->hotHead), _MM_HINT_T0);
+        return true;
     }
 
     // Large Page  ȹ
@@ -0,0 +1,362 @@
+//
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <new>
+#include "RingBuffer.h"
+
+// Ⱑ   ڸ    
+enum class BroadcastOverflow
+{
+    Block,      // Publish  (0 ȯ) -   ڰ   ٸ,  ڰ ü  
+    Overwrite,  //  ޽  - з ڴ  ִ   ޽ ǳʶٰ lap Ƚ 
+};
+
+//  ۼ /   εĳƮ  (disruptor )
+// ۼڰ ޽   ϸ readerCount ڰ  Ŀ  ޽  (ں  )
+//
+// ޽ = [uint32_t ][], Ŀ PowerOfTwoIndex   ϴ 64Ʈ ī (뷮 2 )
+//  Ŀ ڸ ٸ ĳ  - ڳ ƹ͵  ʰ, ۼڴ  ڶ   Ŀ 
+//
+// Overwrite : ۼڴ   ޽ ǳʶ  ġ(_tailPos, ׻ ޽ )    
+// ڴ    ڱ ġ ƴ ٽ Ȯ (seqlock ) -    ȿ
+//
+// Publish  ۼ 忡,  API readerId  忡 ȣ
+class CBroadcastRing
+{
+public:
+    static constexpr size_t MESSAGE_HEADER_SIZE = sizeof(uint32_t);
+
+    CBroadcastRing(size_t capacity, int readerCount, BroadcastOverflow overflow = BroadcastOverflow::Block)
+        : _buffer(nullptr)
+        , _capacity(0)
+        , _mask(0)
+        , _readers(nullptr)
+        , _readerCount(0)
+        , _overflow(overflow)
+        , _writePos(0)
+        , _cachedMinReadPos(0)
+        , _tailPos(0)
+    {
+        if (readerCount <= 0 || !PowerOfTwoIndex::IsValidCapacity(capacity))
+            return;
+
+        _buffer = new (std::nothrow) char[capacity];
+        _readers = new (std::nothrow) ReaderSlot[readerCount];
+        if (_buffer == nullptr || _readers == nullptr)
+        {
+            delete[] _buffer;
+            delete[] _readers;
+            _buffer = nullptr;
+            _readers = nullptr;
+            return;
+        }
+
+        _capacity = capacity;
+        _mask = capacity - 1;
+        _readerCount = readerCount;
+    }
+
+    ~CBroadcastRing()
+    {
+        delete[] _buffer;
+        delete[] _readers;
+    }
+
+    CBroadcastRing(const CBroadcastRing&) = delete;
+    CBroadcastRing& operator=(const CBroadcastRing&) = delete;
+
+    bool IsValid() const
+    {
+        return _buffer != nullptr;
+    }
+
+    // === ۼ API ===
+
+    // ޽ ϳ  ڿ .   size
+    // Block :       0 (All-or-Nothing)
+    // Overwrite :  +  뷮 ̸ ׻ 
+    size_t Publish(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0 || size > UINT32_MAX || _buffer == nullptr)
+            return 0;
+
+        const size_t need = MESSAGE_HEADER_SIZE + size;
+        if (need > _capacity)
+            return 0;
+
+        uint64_t writePos = _writePos.load(std::memory_order_relaxed);
+        uint64_t end = writePos + need;
+
+        if (_overflow == BroadcastOverflow::Block)
+        {
+            // ĳõ ּ  ġ  Ǵϰ,     Ŀ 
+            if (end - _cachedMinReadPos > _capacity)
+            {
+                _cachedMinReadPos = MinReadPos(writePos);
+                if (end - _cachedMinReadPos > _capacity)
+                    return 0;
+            }
+        }
+        else
+        {
+            //   [tail, end - capacity) ޽ ǳʶپ  ޽  ű
+            uint64_t tail = _tailPos.load(std::memory_order_relaxed);
+            if (end - tail > _capacity)
+            {
+                while (end - tail > _capacity)
+                {
+                    uint32_t length = 0;
+                    CopyFromRing(&length, tail, MESSAGE_HEADER_SIZE);
+                    tail += MESSAGE_HEADER_SIZE + length;
+                }
+
+                //   ⺸  ̵  (ڴ   acquire 潺   Ȯ)
+                _tailPos.store(tail, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+        }
+
+        uint32_t header = static_cast<uint32_t>(size);
+        CopyToRing(writePos, &header, MESSAGE_HEADER_SIZE);
+        CopyToRing(writePos + MESSAGE_HEADER_SIZE, data, size);
+
+        // release:  ޽ ڿ  ̵ 
+        _writePos.store(end, std::memory_order_release);
+        return size;
+    }
+
+    // ===  API ===
+
+    //  ޽    ִ 2  ȯ ( count == 0)
+    // ó  ConsumeMessage(readerId) Ѿ -  ConsumeMessage  ȿ (Overwrite  Ʒ )
+    RingSpans PeekMessageSpan(int readerId)
+    {
+        RingSpans spans = {};
+        if (!IsValidReader(readerId))
+            return spans;
+
+        ReaderSlot& reader = _readers[readerId];
+
+        while (true)
+        {
+            uint64_t readPos = reader.pos.load(std::memory_order_relaxed);
+            if (SkipIfLapped(reader, readPos))
+                continue;
+
+            // ǳʶ ڿ ĳõ  ġ readPos   Ƿ ȣ ִ Ÿ 
+            if (static_cast<int64_t>(reader.cachedWritePos - readPos) < static_cast<int64_t>(MESSAGE_HEADER_SIZE))
+            {
+                reader.cachedWritePos = _writePos.load(std::memory_order_acquire);
+                if (reader.cachedWritePos - readPos < MESSAGE_HEADER_SIZE)
+                {
+                    reader.peekedLength = 0;
+                    return spans;
+                }
+            }
+
+            uint32_t length = 0;
+            CopyFromRing(&length, readPos, MESSAGE_HEADER_SIZE);
+
+            //  д ̿  ̸    ->  ǳʶٰ ٽ
+            if (WasOverwritten(readPos))
+                continue;
+
+            reader.peekedLength = length;
+            FillSpans(spans, readPos + MESSAGE_HEADER_SIZE, length);
+            return spans;
+        }
+    }
+
+    // PeekMessageSpan  ޽ ѱ.    ũ
+    // Overwrite 忡 óϴ  ۼڰ ޽  0 - ó   ٽ Peek 
+    size_t ConsumeMessage(int readerId)
+    {
+        if (!IsValidReader(readerId))
+            return 0;
+
+        ReaderSlot& reader = _readers[readerId];
+        uint64_t readPos = reader.pos.load(std::memory_order_relaxed);
+        size_t length = reader.peekedLength;
+
+        // Peek  ȣ ( ׻ 1Ʈ ̻)
+        if (length == 0)
+            return 0;
+
+        reader.peekedLength = 0;
+        if (WasOverwritten(readPos))
+        {
+            SkipIfLapped(reader, readPos);
+            return 0;
+        }
+
+        // release: б⸦ ģ ڿ ۼڰ  ϵ  (Block )
+        reader.pos.store(readPos + MESSAGE_HEADER_SIZE + length, std::memory_order_release);
+        return length;
+    }
+
+    // ޽ ϳ ؼ .    ũ,  ְų size   0 (޽ ܵ)
+    size_t ReadMessage(int readerId, void* data, size_t size)
+    {
+        if (data == nullptr)
+            return 0;
+
+        while (true)
+        {
+            RingSpans spans = PeekMessageSpan(readerId);
+            if (spans.count == 0 || spans.totalSize > size)
+                return 0;
+
+            char* out = static_cast<char*>(data);
+            for (int i = 0; i < spans.count; i++)
+            {
+                std::memcpy(out, spans.vec[i].iov_base, spans.vec[i].iov_len);
+                out += spans.vec[i].iov_len;
+            }
+
+            size_t length = ConsumeMessage(readerId);
+            if (length > 0)
+                return length;
+        }
+    }
+
+    // Overwrite 忡  ڰ з ޽ ǳʶ Ƚ / ǳʶ Ʈ ( )
+    uint64_t GetLapCount(int readerId) const
+    {
+        return IsValidReader(readerId) ? _readers[readerId].lapCount.load(std::memory_order_relaxed) : 0;
+    }
+
+    uint64_t GetSkippedBytes(int readerId) const
+    {
+        return IsValidReader(readerId) ? _readers[readerId].skippedBytes.load(std::memory_order_relaxed) : 0;
+    }
+
+    // ڰ    Ʈ ( ) - Ƽ忡 Ʈ 
+    size_t GetDataSize(int readerId) const
+    {
+        if (!IsValidReader(readerId))
+            return 0;
+
+        uint64_t writePos = _writePos.load(std::memory_order_acquire);
+        uint64_t readPos = _readers[readerId].pos.load(std::memory_order_acquire);
+        return static_cast<size_t>(writePos - readPos);
+    }
+
+    size_t GetCapacity() const
+    {
+        return _capacity;
+    }
+
+    int GetReaderCount() const
+    {
+        return _readerCount;
+    }
+
+private:
+    //  ϳ  - ٸ ڿ ĳ   
+    struct alignas(RINGBUFFER_CACHE_LINE_SIZE) ReaderSlot
+    {
+        std::atomic<uint64_t> pos{ 0 };             // ۼڰ д  ʵ (Block )
+        uint64_t cachedWritePos = 0;                //  Ȯ  ġ
+        size_t peekedLength = 0;                    // PeekMessageSpan   ũ (0̸ Peek )
+        std::atomic<uint64_t> lapCount{ 0 };        // : ٸ 尡   ֵ  
+        std::atomic<uint64_t> skippedBytes{ 0 };
+    };
+
+    bool IsValidReader(int readerId) const
+    {
+        return _buffer != nullptr && readerId >= 0 && readerId < _readerCount;
+    }
+
+    // ۼ :     ó ġ
+    uint64_t MinReadPos(uint64_t writePos) const
+    {
+        uint64_t minPos = writePos;
+        for (int i = 0; i < _readerCount; i++)
+        {
+            uint64_t pos = _readers[i].pos.load(std::memory_order_acquire);
+            if (static_cast<int64_t>(pos - minPos) < 0)
+                minPos = pos;
+        }
+        return minPos;
+    }
+
+    //  : readPos ĸ   ȿ - ۼڰ  readPos ʸӷ Ű   
+    bool WasOverwritten(uint64_t readPos) const
+    {
+        if (_overflow != BroadcastOverflow::Overwrite)
+            return false;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return static_cast<int64_t>(_tailPos.load(std::memory_order_relaxed) - readPos) > 0;
+    }
+
+    //  : з ( ִ   ޽) ǳʶ
+    bool SkipIfLapped(ReaderSlot& reader, uint64_t readPos)
+    {
+        if (_overflow != BroadcastOverflow::Overwrite)
+            return false;
+
+        uint64_t tail = _tailPos.load(std::memory_order_acquire);
+        if (static_cast<int64_t>(tail - readPos) <= 0)
+            return false;
+
+        reader.lapCount.fetch_add(1, std::memory_order_relaxed);
+        reader.skippedBytes.fetch_add(tail - readPos, std::memory_order_relaxed);
+        reader.pos.store(tail, std::memory_order_release);
+        return true;
+    }
+
+    // pos size Ʈ   (wrap  2 )
+    void CopyToRing(uint64_t pos, const void* data, size_t size)
+    {
+        size_t offset = static_cast<size_t>(pos & _mask);
+        size_t first = (std::min)(size, _capacity - offset);
+        std::memcpy(_buffer + offset, data, first);
+        if (size > first)
+            std::memcpy(_buffer, static_cast<const char*>(data) + first, size - first);
+    }
+
+    void CopyFromRing(void* data, uint64_t pos, size_t size) const
+    {
+        size_t offset = static_cast<size_t>(pos & _mask);
+        size_t first = (std::min)(size, _capacity - offset);
+        std::memcpy(data, _buffer + offset, first);
+        if (size > first)
+            std::memcpy(static_cast<char*>(data) + first, _buffer, size - first);
+    }
+
+    void FillSpans(RingSpans& spans, uint64_t pos, size_t size) const
+    {
+        size_t offset = static_cast<size_t>(pos & _mask);
+        size_t first = (std::min)(size, _capacity - offset);
+        spans.vec[0].iov_base = _buffer + offset;
+        spans.vec[0].iov_len = first;
+        spans.count = 1;
+
+        if (size > first)
+        {
+            spans.vec[1].iov_base = _buffer;
+            spans.vec[1].iov_len = size - first;
+            spans.count = 2;
+        }
+
+        spans.totalSize = size;
+    }
+
+private:
+    char* _buffer;
+    size_t _capacity;
+    size_t _mask;
+    ReaderSlot* _readers;
+    int _readerCount;
+    BroadcastOverflow _overflow;
+
+    // ۼ ĳ :  ġ +   ּ  ġ
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint64_t> _writePos;
+    uint64_t _cachedMinReadPos;
+
+    // Overwrite :  ִ   ޽ ġ (ۼڸ ,   ٲ)
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint64_t> _tailPos;
+};
@@ -0,0 +1,608 @@
+//
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <limits>
+#include <type_traits>
+#include "RingBuffer.h"
+
+#ifdef _WIN32
+#include "../MemoryPool_v25/MemoryPool.h"
+#endif
+
+// ûũ Ʈ ⺻ ûũ ũ ( ) -  1
+constexpr size_t CHUNKED_STREAM_DEFAULT_CHUNK_SIZE = 4096;
+
+//  ũ ûũ -  ûũ  + , ü ũⰡ Ȯ ChunkSize
+template<size_t ChunkSize>
+struct StreamChunk
+{
+    static constexpr size_t DATA_SIZE = ChunkSize - sizeof(void*);
+
+    // CMemoryPool::Alloc T()     0 ä ʵ  ڸ 
+    StreamChunk() {}
+
+    StreamChunk* next;
+    char data[DATA_SIZE];
+};
+
+//  ûũ Ʈ ϴ ûũ Ǯ
+// Windows: CMemoryPool (庰 ĳ +   ),  : ؽ free list (  Ҵ )
+//   nullptr ȯ (CMemoryPool ܸ  ʴ TryAlloc )
+template<size_t ChunkSize>
+class CStreamChunkPool
+{
+public:
+    using Chunk = StreamChunk<ChunkSize>;
+
+    CStreamChunkPool()
+        : _useCount(0)
+#ifndef _WIN32
+        , _freeList(nullptr)
+        , _blockList(nullptr)
+        , _freeCount(0)
+        , _blockCount(0)
+#endif
+    {
+    }
+
+    ~CStreamChunkPool()
+    {
+#ifndef _WIN32
+        while (_blockList != nullptr)
+        {
+            Block* next = _blockList->next;
+            ::operator delete(_blockList);
+            _blockList = next;
+        }
+#endif
+    }
+
+    CStreamChunkPool(const CStreamChunkPool&) = delete;
+    CStreamChunkPool& operator=(const CStreamChunkPool&) = delete;
+
+    // ûũ Ʈ ڰ Ǯ     μ  Ǯ
+    static CStreamChunkPool& Default()
+    {
+        static CStreamChunkPool pool;
+        return pool;
+    }
+
+    Chunk* Alloc()
+    {
+        Chunk* chunk = nullptr;
+#ifdef _WIN32
+        chunk = _pool.TryAlloc();
+        if (chunk == nullptr)
+            return nullptr;
+#else
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_freeList == nullptr && !AllocateBlock())
+            return nullptr;
+
+        chunk = _freeList;
+        _freeList = chunk->next;
+        _freeCount--;
+#endif
+        chunk->next = nullptr;
+        _useCount.fetch_add(1, std::memory_order_relaxed);
+        return chunk;
+    }
+
+    void Free(Chunk* chunk)
+    {
+        if (chunk == nullptr)
+            return;
+
+        _useCount.fetch_sub(1, std::memory_order_relaxed);
+#ifdef _WIN32
+        _pool.Free(chunk);
+#else
+        std::lock_guard<std::mutex> guard(_lock);
+        chunk->next = _freeList;
+        _freeList = chunk;
+        _freeCount++;
+#endif
+    }
+
+    // Ʈ  ִ ûũ 
+    size_t GetUseCount() const
+    {
+        return _useCount.load(std::memory_order_relaxed);
+    }
+
+    // Ǯ ݳǾ  ٸ ûũ  (Windows 庰 ĳÿ  ־  )
+    size_t GetFreeCount() const
+    {
+#ifdef _WIN32
+        return 0;
+#else
+        std::lock_guard<std::mutex> guard(_lock);
+        return _freeCount;
+#endif
+    }
+
+private:
+#ifndef _WIN32
+    static constexpr size_t CHUNKS_PER_BLOCK = 64;
+
+    struct Block
+    {
+        Block* next;
+    };
+
+    //  ȿ ȣ: ûũ CHUNKS_PER_BLOCK   Ҵ free list 
+    bool AllocateBlock()
+    {
+        size_t headerSize = (sizeof(Block) + alignof(Chunk) - 1) / alignof(Chunk) * alignof(Chunk);
+        char* memory = static_cast<char*>(::operator new(headerSize + sizeof(Chunk) * CHUNKS_PER_BLOCK, std::nothrow));
+        if (memory == nullptr)
+            return false;
+
+        Block* block = reinterpret_cast<Block*>(memory);
+        block->next = _blockList;
+        _blockList = block;
+        _blockCount++;
+
+        Chunk* chunks = reinterpret_cast<Chunk*>(memory + headerSize);
+        for (size_t i = 0; i < CHUNKS_PER_BLOCK; i++)
+        {
+            Chunk* chunk = new (&chunks[i]) Chunk;
+            chunk->next = _freeList;
+            _freeList = chunk;
+        }
+        _freeCount += CHUNKS_PER_BLOCK;
+        return true;
+    }
+#endif
+
+private:
+    std::atomic<size_t> _useCount;
+#ifdef _WIN32
+    CMemoryPool<Chunk> _pool;
+#else
+    mutable std::mutex _lock;
+    Chunk* _freeList;
+    Block* _blockList;
+    size_t _freeCount;
+    size_t _blockCount;
+#endif
+};
+
+// Ǯ ûũ  (Ǵ  ) Ʈ Ʈ -  Ŭ̾Ʈ ۽ ť
+//   "͸ ų ִġ ̸ Ҵ"ؾ , ûũ Ʈ  ŭ  ûũ ̰
+// о  ûũ  Ǯ  -  ִ  ûũ ϳ    (GetMemoryUsage )
+//
+// Enqueue/EnqueueV/Dequeue/DequeueBatch/Peek/PeekSpans/Consume/Clear CRingBufferT  ǹ (All-or-Nothing )
+// PeekSpans  ûũ ִ 2 ֹǷ, ûũ ü writev Ϸ PeekIoVec 
+//
+//  å NoLock/MutexLock     - ûũ    ٲٹǷ SpscLock  
+template<typename LockPolicy = NoLock, size_t ChunkSize = CHUNKED_STREAM_DEFAULT_CHUNK_SIZE>
+class CChunkedStreamT
+{
+    static_assert(!std::is_same<LockPolicy, SpscLock>::value, "CChunkedStreamT SpscLock  ");
+    static_assert(ChunkSize > sizeof(void*) * 2, "ChunkSize ʹ ");
+
+public:
+    using Pool = CStreamChunkPool<ChunkSize>;
+    using Chunk = typename Pool::Chunk;
+
+    static constexpr size_t CHUNK_DATA_SIZE = Chunk::DATA_SIZE;
+
+    // maxSize:   ִ   (0̸ ),  Enqueue 
+    explicit CChunkedStreamT(size_t maxSize = 0, Pool& pool = Pool::Default())
+        : _pool(&pool)
+        , _head(nullptr)
+        , _tail(nullptr)
+        , _headOffset(0)
+        , _tailOffset(0)
+        , _dataSize(0)
+        , _maxSize(maxSize)
+        , _chunkCount(0)
+        , _peakChunkCount(0)
+    {
+    }
+
+    ~CChunkedStreamT()
+    {
+        ReleaseAll();
+    }
+
+    CChunkedStreamT(const CChunkedStreamT&) = delete;
+    CChunkedStreamT& operator=(const CChunkedStreamT&) = delete;
+
+    // ̸ Ҵϴ  Ƿ ׻ ȿ (CRingBufferT ٲ   ̽)
+    bool IsValid() const
+    {
+        return true;
+    }
+
+    // === Public API ===
+
+    size_t Enqueue(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0)
+            return 0;
+
+        RingIoVec vec = { const_cast<void*>(data), size };
+        return EnqueueV(&vec, 1);
+    }
+
+    //  ۸    ̾  (gather)
+    // All-or-Nothing:  Ѱų ûũ   ϸ ƹ͵  
+    size_t EnqueueV(const RingIoVec* vec, int count)
+    {
+        if (vec == nullptr || count <= 0)
+            return 0;
+
+        size_t totalSize = 0;
+        for (int i = 0; i < count; i++)
+        {
+            if (vec[i].iov_base == nullptr && vec[i].iov_len > 0)
+                return 0;
+            totalSize += vec[i].iov_len;
+        }
+
+        if (totalSize == 0)
+            return 0;
+
+        _lock.lock();
+
+        if (_maxSize != 0 && totalSize > _maxSize - _dataSize)
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        if (!ReserveChunks(totalSize))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            AppendLocked(static_cast<const char*>(vec[i].iov_base), vec[i].iov_len);
+        }
+        _dataSize += totalSize;
+
+        _lock.unlock();
+        return totalSize;
+    }
+
+    size_t Dequeue(void* data, size_t size)
+    {
+        if (data == nullptr || size == 0)
+            return 0;
+
+        _lock.lock();
+
+        // All-or-Nothing: û ũ⸸ŭ Ͱ  
+        if (size > _dataSize)
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        CopyOut(data, size);
+        ConsumeLocked(size);
+
+        _lock.unlock();
+        return size;
+    }
+
+    // ִ ŭ(ִ maxSize)  - All-or-Nothing ƴ
+    size_t DequeueBatch(void* data, size_t maxSize)
+    {
+        if (data == nullptr || maxSize == 0)
+            return 0;
+
+        _lock.lock();
+
+        size_t size = (std::min)(maxSize, _dataSize);
+        if (size > 0)
+        {
+            CopyOut(data, size);
+            ConsumeLocked(size);
+        }
+
+        _lock.unlock();
+        return size;
+    }
+
+    size_t Peek(void* data, size_t size) const
+    {
+        if (data == nullptr || size == 0)
+            return 0;
+
+        _lock.lock();
+
+        if (size > _dataSize)
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        CopyOut(data, size);
+
+        _lock.unlock();
+        return size;
+    }
+
+    //  ûũ ִ 2   ȯ (CRingBufferT::PeekSpans  )
+    // totalSize ü Ͱ ƴ϶    -  Consume  ٽ Peek
+    RingSpans PeekSpans() const
+    {
+        RingSpans spans = {};
+
+        _lock.lock();
+        spans.count = FillIoVec(spans.vec, 2, spans.totalSize);
+        _lock.unlock();
+
+        return spans;
+    }
+
+    // տ ִ maxCount ûũ  ä (writev/WSASend ٷ ), ä  ȯ
+    // totalSize ä  հ - ó ŭ Consume 
+    int PeekIoVec(RingIoVec* vec, int maxCount, size_t& totalSize) const
+    {
+        totalSize = 0;
+        if (vec == nullptr || maxCount <= 0)
+            return 0;
+
+        _lock.lock();
+        int count = FillIoVec(vec, maxCount, totalSize);
+        _lock.unlock();
+
+        return count;
+    }
+
+    // տ size Ʈ ,   ûũ Ǯ ݳ
+    size_t Consume(size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        _lock.lock();
+
+        if (size > _dataSize)
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        ConsumeLocked(size);
+
+        _lock.unlock();
+        return size;
+    }
+
+    void Clear()
+    {
+        _lock.lock();
+        ReleaseAll();
+        _lock.unlock();
+    }
+
+    size_t GetDataSize() const
+    {
+        _lock.lock();
+        size_t dataSize = _dataSize;
+        _lock.unlock();
+        return dataSize;
+    }
+
+    // ѱ  ũ (̸ size_t ִ밪 )
+    size_t GetFreeSize() const
+    {
+        size_t limit = _maxSize != 0 ? _maxSize : (std::numeric_limits<size_t>::max)();
+        return limit - GetDataSize();
+    }
+
+    size_t GetMaxSize() const
+    {
+        return _maxSize;
+    }
+
+    size_t GetChunkCount() const
+    {
+        _lock.lock();
+        size_t chunkCount = _chunkCount;
+        _lock.unlock();
+        return chunkCount;
+    }
+
+    //    ִ ûũ  (۽ ť ִ з )
+    size_t GetPeakChunkCount() const
+    {
+        _lock.lock();
+        size_t peak = _peakChunkCount;
+        _lock.unlock();
+        return peak;
+    }
+
+    //    ϴ ޸ (ü +  ִ ûũ) -   sizeof(*this)
+    size_t GetMemoryUsage() const
+    {
+        return sizeof(*this) + GetChunkCount() * ChunkSize;
+    }
+
+    Pool& GetPool() const
+    {
+        return *_pool;
+    }
+
+private:
+    //  ȿ ȣ:  ûũ    ŭ ûũ ̸ ޾  
+    // ߰ Ǯ ϸ  ûũ ְ false -  ʹ ״
+    bool ReserveChunks(size_t size)
+    {
+        size_t tailFree = _tail != nullptr ? CHUNK_DATA_SIZE - _tailOffset : 0;
+        if (size <= tailFree)
+            return true;
+
+        size_t needed = (size - tailFree + CHUNK_DATA_SIZE - 1) / CHUNK_DATA_SIZE;
+
+        Chunk* first = nullptr;
+        Chunk* last = nullptr;
+        for (size_t i = 0; i < needed; i++)
+        {
+            Chunk* chunk = _pool->Alloc();
+            if (chunk == nullptr)
+            {
+                while (first != nullptr)
+                {
+                    Chunk* next = first->next;
+                    _pool->Free(first);
+                    first = next;
+                }
+                return false;
+            }
+
+            if (last != nullptr)
+                last->next = chunk;
+            else
+                first = chunk;
+            last = chunk;
+        }
+
+        //  ûũ  ڿ ٿ ΰ, AppendLocked  ä Ѿ
+        if (_tail != nullptr)
+        {
+            _tail->next = first;
+        }
+        else
+        {
+            _head = first;
+            _tail = first;
+            _headOffset = 0;
+            _tailOffset = 0;
+        }
+
+        _chunkCount += needed;
+        _peakChunkCount = (std::max)(_peakChunkCount, _chunkCount);
+        return true;
+    }
+
+    //  ȿ ȣ: ReserveChunks  Ȯ ¿  ̾ 
+    void AppendLocked(const char* data, size_t size)
+    {
+        while (size > 0)
+        {
+            if (_tailOffset == CHUNK_DATA_SIZE)
+            {
+                _tail = _tail->next;
+                _tailOffset = 0;
+            }
+
+            size_t copySize = (std::min)(size, CHUNK_DATA_SIZE - _tailOffset);
+            std::memcpy(_tail->data + _tailOffset, data, copySize);
+            _tailOffset += copySize;
+            data += copySize;
+            size -= copySize;
+        }
+    }
+
+    //  ȿ ȣ: Ӹ size Ʈ  (size <= _dataSize)
+    void CopyOut(void* data, size_t size) const
+    {
+        char* out = static_cast<char*>(data);
+        const Chunk* chunk = _head;
+        size_t offset = _headOffset;
+
+        while (size > 0)
+        {
+            size_t copySize = (std::min)(size, CHUNK_DATA_SIZE - offset);
+            std::memcpy(out, chunk->data + offset, copySize);
+            out += copySize;
+            size -= copySize;
+            chunk = chunk->next;
+            offset = 0;
+        }
+    }
+
+    //  ȿ ȣ: Ӹ size Ʈ  (size <= _dataSize),   ûũ ݳ
+    void ConsumeLocked(size_t size)
+    {
+        _dataSize -= size;
+
+        //    ûũ ݳ -   ûũ 0
+        if (_dataSize == 0)
+        {
+            ReleaseAll();
+            return;
+        }
+
+        _headOffset += size;
+        while (_headOffset >= CHUNK_DATA_SIZE)
+        {
+            Chunk* next = _head->next;
+            _pool->Free(_head);
+            _chunkCount--;
+            _head = next;
+            _headOffset -= CHUNK_DATA_SIZE;
+        }
+    }
+
+    //  ȿ ȣ: Ӹ ûũ  ִ maxCount ä
+    int FillIoVec(RingIoVec* vec, int maxCount, size_t& totalSize) const
+    {
+        totalSize = 0;
+
+        int count = 0;
+        size_t remain = _dataSize;
+        const Chunk* chunk = _head;
+        size_t offset = _headOffset;
+
+        while (remain > 0 && count < maxCount)
+        {
+            size_t length = (std::min)(remain, CHUNK_DATA_SIZE - offset);
+            vec[count].iov_base = const_cast<char*>(chunk->data + offset);
+            vec[count].iov_len = length;
+            count++;
+
+            totalSize += length;
+            remain -= length;
+            chunk = chunk->next;
+            offset = 0;
+        }
+
+        return count;
+    }
+
+    //  ȿ ȣ (Ҹ ): ุ ϰ   ûũ  ݳ
+    void ReleaseAll()
+    {
+        while (_head != nullptr)
+        {
+            Chunk* next = _head->next;
+            _pool->Free(_head);
+            _head = next;
+        }
+
+        _tail = nullptr;
+        _headOffset = 0;
+        _tailOffset = 0;
+        _dataSize = 0;
+        _chunkCount = 0;
+    }
+
+private:
+    Pool* _pool;
+    Chunk* _head;           // б ûũ
+    Chunk* _tail;           //  ûũ (  ûũ ڿ  پ   )
+    size_t _headOffset;     // _head  б ġ
+    size_t _tailOffset;     // _tail   ġ
+    size_t _dataSize;
+    size_t _maxSize;        // 0̸ 
+    size_t _chunkCount;     //  ִ ûũ  ( )
+    size_t _peakChunkCount;
+    mutable LockPolicy _lock;
+};
+
+// ===  Ÿ  ===
+using CChunkedStreamST = CChunkedStreamT<NoLock>;       // ̱۽ 
+using CChunkedStreamMT = CChunkedStreamT<MutexLock>;    // Ƽ  ( ۽ ť)
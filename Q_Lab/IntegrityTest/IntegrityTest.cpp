@@ -11,7 +11,27 @@
 #include <memory> 
 #include <set>
 #include <string>
+#include <cstdio>
+#include "../RingSocketIo.h"     // winsock2.h가 windows.h보다 먼저 오도록 가장 앞에
 #include "../RingBuffer.h"
+#include "../RecordRingMPMC.h"
+#include "../SharedMemoryRing.h"
+#include "../JournalRing.h"
+#include "../RingFanIn.h"
+#include "../BroadcastRing.h"
+#include "../ChunkedStream.h"
+#include "../PriorityRing.h"
+#include "../RingCoroutine.h"
+
+#ifdef __linux__
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef _WIN32
+#include <io.h>
+#endif
 
 //=============================================================================
 // 테스트 설정 상수 (반복 횟수 조절 가능)
@@ -25,8 +45,30 @@ namespace TestConfig
 
     // Phase 2: 멀티스레드 테스트
 	const uint64_t NUMBERS_PER_THREAD = 10'000'000; // 각 생산자 스레드가 생성할 숫자 개수 (Producer-Consumer)
+    const int OBSERVER_PEEK_INTERVAL_US = 20; // Producer-Consumer 관찰자 스레드: Peek 사이 대기 시간 (마이크로초)
     const uint64_t PEEK_CONSUME_PER_THREAD = 10'000'000; // 각 생산자 스레드가 생성할 숫자 개수 (Peek+Consume)
     const uint64_t HIGH_CONTENTION_OPS_PER_THREAD = 10'000'000; // 각 스레드당 작업 횟수 (고빈도 경합)
+    const uint64_t GROWABLE_ITERATIONS = 10'000'000; // 성장 모드 단일 스레드 반복 횟수
+    const uint64_t GROWABLE_NUMBERS_PER_THREAD = 1'000'000; // 성장 모드 멀티스레드: 각 생산자 스레드가 생성할 숫자 개수
+    const uint64_t SHARED_MEMORY_BYTES = 100'000'000; // 공유 메모리 2-프로세스 테스트 전송 바이트 수
+    const uint64_t RING_QUEUE_ITERATIONS = 10'000'000; // 타입 큐 단일 스레드 반복 횟수 (무결성/불변성 각각)
+    const uint64_t FAN_IN_NUMBERS_PER_THREAD = 2'000'000; // fan-in N:1 테스트: 각 생산자 스레드가 보낼 숫자 개수
+    const uint64_t BROADCAST_MESSAGES = 2'000'000; // 브로드캐스트 링 테스트: 작성자가 보낼 메시지 개수
+    const uint64_t STREAMING_SWEEP_BYTES = 256'000'000; // 스트리밍 복사 비교: 메시지 크기별 전송 바이트 수
+    const uint64_t FIXED_SIZE_ITERATIONS = 10'000'000; // 고정 크기 Push/Pop: 무결성 반복 횟수 및 크기별 전송 횟수
+    const uint64_t FIXED_SIZE_CONTENTION_OPS_PER_THREAD = 5'000'000; // 고정 크기 Push/Pop: 1바이트 경합 비교 스레드당 작업 횟수
+    const int CHUNKED_STREAM_SESSIONS = 10'000; // 청크 스트림 유휴 세션 메모리 측정: 세션 개수
+    const uint64_t LATENCY_TRACE_MESSAGES = 5'000'000; // 지연 시간 추적: SPSC 구간별 메시지 개수
+    const uint64_t PRIORITY_MESSAGES_PER_PRODUCER = 500'000; // 우선순위 링 순서 검증: 각 생산자 스레드가 보낼 메시지 개수
+    const int PRIORITY_CONTROL_MESSAGES = 500; // 우선순위 링 포화 테스트: 1ms 간격으로 보낼 제어 패킷 개수 (방식별)
+    const uint64_t RECORD_ITERATIONS = 1'000'000; // 체크섬 레코드: 왕복 반복 횟수 및 장애 주입 횟수 (방식별)
+    const uint64_t RECORD_THROUGHPUT_BYTES = 256'000'000; // 체크섬 레코드 처리량 비교: 메시지 크기별 전송 바이트 수
+    const uint64_t SOCKET_STREAM_BYTES = 1'000'000'000; // 소켓 입출력 비교: socketpair로 흘려보낼 바이트 수 (방식별)
+    const uint64_t COROUTINE_MESSAGES = 1'000'000; // 코루틴 대기: 정확성 검증 메시지 개수 (스트리밍 비교는 10배)
+    const uint64_t COROUTINE_PINGPONG_ROUNDS = 200'000; // 코루틴 대기: 코루틴 vs 스레드 핑퐁 왕복 횟수
+    const uint64_t JOURNAL_NUMBERS = 10'000'000; // 저널 링 벤치마크: 기록할 숫자 개수 (방식별)
+    const int LOW_RATE_MESSAGES_PER_THREAD = 2'000; // 저빈도 블로킹 테스트: 각 생산자 스레드가 보낼 숫자 개수
+    const int LOW_RATE_INTERVAL_US = 1'000;         // 저빈도 블로킹 테스트: 생산자 전송 간격 (마이크로초)
 
     // 진행 상황 출력 주기
     const uint64_t PROGRESS_INTERVAL = 10'000'000; // 설정된 값 마다 모니터링 출력
@@ -55,6 +97,52 @@ void Crash()
         } \
     } while(0)
 
+// 링 내부 구간(최대 2개)에서 size 바이트를 연속 버퍼로 조립 (wrap 지점에서 int가 잘릴 수 있음)
+void CopyFromSpans(const RingSpans& spans, void* dst, size_t size)
+{
+    char* out = static_cast<char*>(dst);
+    for (int i = 0; i < spans.count && size > 0; i++)
+    {
+        size_t len = (std::min)(size, spans.vec[i].iov_len);
+        std::memcpy(out, spans.vec[i].iov_base, len);
+        out += len;
+        size -= len;
+    }
+}
+
+// Jain 공정성 지수: (Σx)² / (n·Σx²), 모든 스레드가 같은 양을 처리하면 1.0, 한 스레드가 독점하면 1/n
+double CalcJainFairness(const std::vector<uint64_t>& perThread)
+{
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    for (size_t i = 0; i < perThread.size(); i++)
+    {
+        sum += (double)perThread[i];
+        sumSquares += (double)perThread[i] * (double)perThread[i];
+    }
+
+    if (sumSquares == 0.0)
+        return 0.0;
+    return sum * sum / (perThread.size() * sumSquares);
+}
+
+// 현재 스레드가 사용한 CPU 시간 (ms, 사용자 + 커널)
+double GetThreadCpuTimeMs()
+{
+#ifdef _WIN32
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+        return 0.0;
+    ULARGE_INTEGER kernel = { kernelTime.dwLowDateTime, kernelTime.dwHighDateTime };
+    ULARGE_INTEGER user = { userTime.dwLowDateTime, userTime.dwHighDateTime };
+    return (kernel.QuadPart + user.QuadPart) / 10000.0; // 100ns 단위
+#else
+    timespec ts = {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+#endif
+}
+
 // 진행 상황 출력
 void PrintProgress(const char* testName, uint64_t current, uint64_t total)
 {
@@ -71,15 +159,17 @@ void PrintProgress(const char* testName, uint64_t current, uint64_t total)
 // Phase 1-1: 싱글 스레드 - 데이터 무결성 반복 테스트
 // 데이터 순서, 손상 여부 검증
 //=============================================================================
-void Test_DataIntegrity()
+// RingType: 테스트할 링 버퍼 타입 (기본 CRingBufferST, 저장소 정책 검증 시 교체)
+template<typename RingType = CRingBufferST>
+void Test_DataIntegrity(const char* ringName = "CRingBufferST")
 {
     std::cout << "\n========================================" << std::endl;
-    std::cout << "[Phase 1-1] 데이터 무결성 테스트 시작" << std::endl;
+    std::cout << "[Phase 1-1] 데이터 무결성 테스트 시작 (" << ringName << ")" << std::endl;
     std::cout << "  목표: " << TestConfig::DATA_INTEGRITY_ITERATIONS / 1'000'000 << "백만 번 반복" << std::endl;
     std::cout << "========================================" << std::endl;
 
     const uint64_t ITERATIONS = TestConfig::DATA_INTEGRITY_ITERATIONS;
-    auto container = std::make_unique<CRingBufferST>(8192);
+    auto container = std::make_unique<RingType>(8192);
     if (!container->IsValid())
     {
         std::cout << "[ERROR] RingBuffer 할당 실패" << std::endl;
@@ -175,21 +265,25 @@ void Test_DataIntegrity()
 // Phase 1-2: 싱글 스레드 - 불변성(Invariant) 
 // 무작위 작업 (Enque/Deque/Peek/Consume/Clear) 후 DataSize, FreeSize 검사
 //=============================================================================
-void Test_Invariants()
+template<typename RingType = CRingBufferST>
+void Test_Invariants(const char* ringName = "CRingBufferST")
 {
     std::cout << "\n========================================" << std::endl;
-    std::cout << "[Phase 1-2] 불변성 검증 테스트 시작" << std::endl;
+    std::cout << "[Phase 1-2] 불변성 검증 테스트 시작 (" << ringName << ")" << std::endl;
     std::cout << "  목표: " << TestConfig::INVARIANT_ITERATIONS / 1'000'000 << "백만 번 반복" << std::endl;
     std::cout << "========================================" << std::endl;
 
     const uint64_t ITERATIONS = TestConfig::INVARIANT_ITERATIONS;
-    auto container = std::make_unique<CRingBufferST>(4096);
+    auto container = std::make_unique<RingType>(4096);
     if (!container->IsValid())
     {
         std::cout << "[ERROR] RingBuffer 할당 실패" << std::endl;
         return;
     }
 
+    // 저장소 정책에 따라 용량이 올림될 수 있으므로 빈 버퍼의 FreeSize를 기준으로 사용
+    const size_t capacity = container->GetFreeSize();
+
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_int_distribution<> sizeDis(1, 512);
@@ -205,7 +299,6 @@ void Test_Invariants()
 
         size_t beforeDataSize = container->GetDataSize();
         size_t beforeFreeSize = container->GetFreeSize();
-        size_t capacity = 4095;
 
 		// [사용중인 공간 + 여유 공간 = 용량 - 1] 확인
         TEST_ASSERT(beforeDataSize + beforeFreeSize == capacity,
@@ -286,9 +379,11 @@ void Test_Invariants()
 //=============================================================================
 void Test_BoundaryConditions()
 {
+    const uint64_t SCENARIO_COUNT = 6;
+
     std::cout << "\n========================================" << std::endl;
     std::cout << "[Phase 1-3] 경계 조건 테스트 시작" << std::endl;
-    std::cout << "  목표: " << TestConfig::BOUNDARY_ITERATIONS_PER_SCENARIO * 3 / 1'000'000 << "백만 번 반복 (3개 시나리오)" << std::endl;
+    std::cout << "  목표: " << TestConfig::BOUNDARY_ITERATIONS_PER_SCENARIO * SCENARIO_COUNT / 1'000'000 << "백만 번 반복 (" << SCENARIO_COUNT << "개 시나리오)" << std::endl;
     std::cout << "========================================" << std::endl;
 
     const uint64_t ITERATIONS = TestConfig::BOUNDARY_ITERATIONS_PER_SCENARIO;
@@ -400,8 +495,162 @@ void Test_BoundaryConditions()
         std::cout << "  완료: " << elapsed << "초" << std::endl;
     }
 
+    // 시나리오 4: 2의 제곱 모드 - 64비트 커서 카운터 Wrap-Around
+    {
+        std::cout << "\n[시나리오 4] 2의 제곱 모드 64비트 카운터 Wrap-Around 테스트" << std::endl;
+        auto container = std::make_unique<CRingBufferPow2ST>(1024);
+        TEST_ASSERT(container->IsValid(), "2의 제곱 용량 생성 실패");
+
+        std::vector<char> writeData(700);
+        std::vector<char> readData(700);
+        auto startTime = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < ITERATIONS; i++)
+        {
+            g_totalIterations = i;
+            PrintProgress("64비트 Wrap", i, ITERATIONS);
+
+            // 1. 커서를 2^64 직전으로 이동 (버퍼 내 위치도 매번 달라짐)
+            uint64_t base = UINT64_MAX - (i % 1024);
+            bool reset = container->SetCursorBase(base);
+            TEST_ASSERT(reset, "SetCursorBase 실패");
+
+            // 2. 쓰기 (i % 1024 < 700 이면 커서 카운터가 2^64를 넘어 0 근처로 wrap)
+            for (size_t j = 0; j < writeData.size(); j++)
+                writeData[j] = static_cast<char>(i + j);
+
+            size_t written = container->Enqueue(writeData.data(), writeData.size());
+            TEST_ASSERT(written == writeData.size(), "카운터 wrap 쓰기 실패");
+            TEST_ASSERT(container->GetDataSize() == writeData.size(), "카운터 wrap 후 DataSize 불일치");
+            TEST_ASSERT(container->GetFreeSize() == 1024 - writeData.size(), "카운터 wrap 후 FreeSize 불일치");
+
+            // 3. wrap을 넘어가는 Peek/Dequeue 후 데이터 비교
+            size_t peeked = container->Peek(readData.data(), 300);
+            TEST_ASSERT(peeked == 300, "카운터 wrap Peek 실패");
+            TEST_ASSERT(std::memcmp(readData.data(), writeData.data(), 300) == 0, "카운터 wrap Peek 데이터 손상");
+
+            size_t read = container->Dequeue(readData.data(), readData.size());
+            TEST_ASSERT(read == readData.size(), "카운터 wrap 읽기 실패");
+            TEST_ASSERT(std::memcmp(readData.data(), writeData.data(), readData.size()) == 0, "카운터 wrap 데이터 손상");
+            TEST_ASSERT(container->GetDataSize() == 0, "카운터 wrap 후 Empty 실패");
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+        std::cout << "  완료: " << elapsed << "초" << std::endl;
+    }
+
+    // 시나리오 5: 2의 제곱 모드 - 용량 전체 사용 (1바이트 손실 없음)
+    {
+        std::cout << "\n[시나리오 5] 2의 제곱 모드 전체 용량 테스트" << std::endl;
+        auto invalidContainer = std::make_unique<CRingBufferPow2ST>(1000);
+        TEST_ASSERT(!invalidContainer->IsValid(), "2의 제곱이 아닌 용량 허용됨");
+
+        auto container = std::make_unique<CRingBufferPow2ST>(512);
+        std::vector<char> fillData(512);
+        auto startTime = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < ITERATIONS; i++)
+        {
+            g_totalIterations = i;
+            PrintProgress("전체 용량", i, ITERATIONS);
+
+            // 시작 위치를 매번 옮겨 경계에 걸친 Full 상태를 확인
+            size_t shift = static_cast<size_t>(i % 512);
+            if (shift > 0)
+            {
+                container->Enqueue(fillData.data(), shift);
+                container->Consume(shift);
+            }
+
+            size_t written = container->Enqueue(fillData.data(), fillData.size());
+            TEST_ASSERT(written == 512, "전체 용량 쓰기 실패");
+            TEST_ASSERT(container->GetFreeSize() == 0, "Full 상태 FreeSize가 0이 아님");
+            TEST_ASSERT(container->GetDataSize() == 512, "Full 상태 DataSize 불일치");
+
+            char byte = 0;
+            written = container->Enqueue(&byte, 1);
+            TEST_ASSERT(written == 0, "Full 버퍼에 쓰기 성공");
+
+            size_t read = container->Dequeue(fillData.data(), fillData.size());
+            TEST_ASSERT(read == 512, "전체 용량 읽기 실패");
+            TEST_ASSERT(container->GetDataSize() == 0, "전체 읽기 후 Empty 실패");
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+        std::cout << "  완료: " << elapsed << "초" << std::endl;
+    }
+
+    // 시나리오 6: ReserveWrite/CommitWrite 2단계 쓰기 - wrap 지점에 걸친 예약
+    {
+        std::cout << "\n[시나리오 6] Reserve/Commit Wrap-Around 테스트" << std::endl;
+        auto container = std::make_unique<CRingBufferST>(1024);
+        std::vector<char> readData(1023);
+        uint8_t sequence = 0;
+        uint8_t expected = 0;
+        uint64_t wrapCount = 0;
+        auto startTime = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < ITERATIONS; i++)
+        {
+            g_totalIterations = i;
+            PrintProgress("Reserve/Commit", i, ITERATIONS);
+
+            // 1. 예약 크기를 매번 바꿔 쓰기 위치가 경계 전후를 돌도록 함
+            size_t reserveSize = static_cast<size_t>(i % 1023) + 1;
+            RingSpans spans = container->ReserveWrite(reserveSize);
+            TEST_ASSERT(spans.count == 1 || spans.count == 2, "ReserveWrite 실패");
+            TEST_ASSERT(spans.totalSize == reserveSize, "ReserveWrite 크기 불일치");
+            TEST_ASSERT(spans.vec[0].iov_len + (spans.count == 2 ? spans.vec[1].iov_len : 0) == reserveSize,
+                "ReserveWrite 구간 길이 합 불일치");
+            if (spans.count == 2)
+                wrapCount++;
+
+            // 2. 임시 버퍼 없이 링 내부에 직접 시퀀스 기록
+            for (int s = 0; s < spans.count; s++)
+            {
+                uint8_t* dst = static_cast<uint8_t*>(spans.vec[s].iov_base);
+                for (size_t j = 0; j < spans.vec[s].iov_len; j++)
+                    dst[j] = sequence++;
+            }
+
+            // 3. 절반만 공개 (recv()가 덜 채운 경우) - 나머지는 버려지므로 시퀀스 되돌림
+            size_t commitSize = (i % 3 == 0) ? reserveSize / 2 : reserveSize;
+            sequence = static_cast<uint8_t>(sequence - (reserveSize - commitSize));
+            size_t committed = container->CommitWrite(commitSize);
+            TEST_ASSERT(committed == commitSize, "CommitWrite 크기 불일치");
+            TEST_ASSERT(container->GetDataSize() == commitSize, "CommitWrite 후 DataSize 불일치");
+
+            // 4. 공개된 만큼만 읽히는지 확인
+            if (commitSize > 0)
+            {
+                size_t read = container->Dequeue(readData.data(), commitSize);
+                TEST_ASSERT(read == commitSize, "Reserve/Commit 데이터 읽기 실패");
+                for (size_t j = 0; j < commitSize; j++)
+                {
+                    TEST_ASSERT(static_cast<uint8_t>(readData[j]) == expected, "Reserve/Commit 데이터 손상");
+                    expected++;
+                }
+            }
+            TEST_ASSERT(container->GetDataSize() == 0, "Reserve/Commit 후 Empty 실패");
+        }
+
+        TEST_ASSERT(wrapCount > 0, "wrap 지점에 걸친 예약이 한 번도 발생하지 않음");
+
+        // 5. 공간 초과 예약은 실패, 예약 없는 Commit은 무시
+        RingSpans overSpans = container->ReserveWrite(1024);
+        TEST_ASSERT(overSpans.count == 0 && overSpans.totalSize == 0, "capacity 초과 예약 허용됨");
+        TEST_ASSERT(container->CommitWrite(10) == 0, "예약 없는 CommitWrite 허용됨");
+        TEST_ASSERT(container->GetDataSize() == 0, "예약 없는 CommitWrite 후 DataSize 변경");
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+        std::cout << "  완료: " << elapsed << "초" << std::endl;
+    }
+
     std::cout << "\n[PASS] 경계 조건 테스트 완료!" << std::endl;
-    std::cout << "  - 총 반복: " << ITERATIONS * 3 << " 회" << std::endl;
+    std::cout << "  - 총 반복: " << ITERATIONS * SCENARIO_COUNT << " 회" << std::endl;
 
     g_testCount++;
 }
@@ -411,14 +660,58 @@ void Test_BoundaryConditions()
 // 여러 생산자/소비자 스레드로 데이터 무결성 검증
 //=============================================================================
 
+// Producer-Consumer 테스트의 Enqueue/Dequeue 방식
+enum class ProducerConsumerMode
+{
+    Bytes,      // 숫자 묶음마다 Enqueue, 랜덤 크기 Dequeue (기본)
+    Framed,     // 숫자 묶음 하나 = 메시지 하나 (EnqueueMessage/DequeueMessage, 메시지 경계 검증)
+    Batch       // 묶음 여러 개를 EnqueueV 한 번으로, 있는 만큼 DequeueBatch 한 번으로
+};
+
+// 관찰자(모니터링) 스레드가 맨 앞 데이터를 엿보는 방식
+enum class ObserverPeekMode
+{
+    Locked,     // Peek - 생산자/소비자와 같은 락을 잡음
+    Consistent  // TryPeekConsistent - 락 없이 읽고 순번으로 검증
+};
+
+struct ProducerConsumerResult
+{
+    double throughputMB;        // 처리량 (MB/s)
+    uint64_t lockAcquireCount;  // 락 획득 횟수 (CountingLock일 때만, 아니면 0)
+    double consumerFairness;    // 소비자별 Dequeue 개수의 Jain 공정성 지수
+    uint64_t observerPeeks;     // 관찰자 스레드가 성공한 Peek 횟수 (관찰자가 없으면 0)
+};
+
+// 락 정책별 획득 횟수 조회 (CountingLock만 값이 있음)
+template<typename LockPolicy>
+uint64_t GetLockAcquireCount(const LockPolicy&)
+{
+    return 0;
+}
+
+template<typename InnerLock>
+uint64_t GetLockAcquireCount(const CountingLock<InnerLock>& lock)
+{
+    return lock._acquireCount;
+}
+
 // 파라미터화된 테스트 함수 (진행률/완료 현황 상단 고정)
-void RunProducerConsumerTest(
+// RingType: CRingBufferMT 또는 CRingBufferSPSC (SPSC는 1:1 조합에서만 사용)
+template<typename RingType>
+ProducerConsumerResult RunProducerConsumerTest(
 	int producerCount,  // 생산자 스레드 수
 	int consumerCount,  // 소비자 스레드 수
 	int numbersPerThread, // 각 생산자 스레드가 생성할 숫자 개수
     const std::vector<std::string>& completedLines,
-    const std::string& runningLine)
+    const std::string& runningLine,
+    ProducerConsumerMode mode = ProducerConsumerMode::Bytes,
+    int observerCount = 0,  // 맨 앞 데이터를 계속 엿보는 관찰자 스레드 수 (데이터를 꺼내지 않음)
+    ObserverPeekMode observerMode = ObserverPeekMode::Consistent)
 {
+    const bool framed = (mode == ProducerConsumerMode::Framed);
+    ProducerConsumerResult result = {};
+
 	const int TOTAL_NUMBERS = numbersPerThread * producerCount; // 전체 숫자 개수
     std::atomic<uint64_t> totalEnqueued(0);
     std::atomic<uint64_t> totalDequeued(0); 
@@ -426,12 +719,14 @@ void RunProducerConsumerTest(
     std::atomic<bool> allProducersDone(false);
     std::atomic<int> producersCompleted(0);    
     std::atomic<int> consumersCompleted(0);
+    std::vector<uint64_t> perConsumerDequeued(consumerCount, 0);
+    std::atomic<uint64_t> totalObserverPeeks(0);
 
-    auto container = std::make_unique<CRingBufferMT>(65536);
+    auto container = std::make_unique<RingType>(65536);
     if (!container->IsValid())
     {
         std::cout << "[ERROR] RingBuffer 할당 실패" << std::endl;
-        return;
+        return result;
     }
 
     // dequeueCheck를 힙에 unique_ptr로 할당
@@ -439,7 +734,7 @@ void RunProducerConsumerTest(
     if (!dequeueCheck)
     {
         std::cout << "[ERROR] dequeueCheck 메모리 할당 실패: " << TOTAL_NUMBERS << std::endl;
-        return;
+        return result;
     }
 
     // dequeueCheck 초기화
@@ -488,13 +783,52 @@ void RunProducerConsumerTest(
         {
             std::mt19937 gen(rd() + threadId);
             std::uniform_int_distribution<> sizeDis(1, 32);  // 1~32개 숫자 (8~256바이트)
+            std::uniform_int_distribution<> vecDis(1, 8);    // Batch 모드: EnqueueV 한 번에 넣을 묶음 수
 
             int startNum = threadId * numbersPerThread;
             int endNum = startNum + numbersPerThread;
             int currentNum = startNum;
 
+            std::vector<int> gatherBatches[8];
+            RingIoVec gatherVec[8];
+
             while (currentNum < endNum)
             {
+                if (mode == ProducerConsumerMode::Batch)
+                {
+                    // 묶음 여러 개를 각자의 버퍼에 만들고 EnqueueV 한 번(락 1회)으로 기록
+                    int vecCount = vecDis(gen);
+                    int produced = 0;
+                    size_t gatherSize = 0;
+                    int used = 0;
+
+                    for (; used < vecCount && currentNum + produced < endNum; used++)
+                    {
+                        int batchSize = (std::min)(sizeDis(gen), endNum - currentNum - produced);
+                        gatherBatches[used].clear();
+                        for (int i = 0; i < batchSize; i++)
+                        {
+                            gatherBatches[used].push_back(currentNum + produced + i);
+                        }
+
+                        gatherVec[used].iov_base = gatherBatches[used].data();
+                        gatherVec[used].iov_len = batchSize * sizeof(int);
+                        gatherSize += gatherVec[used].iov_len;
+                        produced += batchSize;
+                    }
+
+                    size_t gathered = 0;
+                    while (gathered == 0)
+                    {
+                        gathered = container->EnqueueV(gatherVec, used);
+                    }
+
+                    TEST_ASSERT(gathered == gatherSize, "EnqueueV 크기 불일치");
+                    currentNum += produced;
+                    totalEnqueued += produced;
+                    continue;
+                }
+
                 // 랜덤 개수만큼 숫자 묶음 생성 (8~256바이트)
                 int batchSize = (std::min)(sizeDis(gen), endNum - currentNum);
                 std::vector<int> batch;
@@ -510,7 +844,10 @@ void RunProducerConsumerTest(
                 // All-or-Nothing: 전체 쓰기 성공할 때까지 재시도
                 while (written == 0) 
                 {
-                    written = container->Enqueue(batch.data(), totalSize);
+                    if (framed)
+                        written = container->EnqueueMessage(batch.data(), totalSize);
+                    else
+                        written = container->Enqueue(batch.data(), totalSize);
 
                     // 일부러 경합 유발을 위해 짧은 대기 추가하지 않음
                 }
@@ -530,7 +867,8 @@ void RunProducerConsumerTest(
         {
             std::mt19937 gen(rd() + 1000 + consumerId);
             std::uniform_int_distribution<> sizeDis(1, 32);
-            std::vector<int> readBuffer(32);
+            std::vector<int> readBuffer(mode == ProducerConsumerMode::Batch ? 256 : 32);
+            uint64_t myDequeued = 0;
 
             while (true)
             {
@@ -540,17 +878,63 @@ void RunProducerConsumerTest(
                     break;
                 }
 
-                // 랜덤 크기로 Dequeue 시도 (8~256바이트)
-                int requestCount = sizeDis(gen);
-                size_t requestSize = requestCount * sizeof(int);
-                size_t read = container->Dequeue(readBuffer.data(), requestSize);
-
-                // All-or-Nothing: 0 또는 requestSize만 가능
-                TEST_ASSERT(read == 0 || read == requestSize, "All-or-Nothing 위반: 부분 읽기 " + std::to_string(read) + " 발생");
+                size_t read = 0;
 
-                if (read == 0)
+                if (mode == ProducerConsumerMode::Batch)
                 {
-                    continue;
+                    // 있는 만큼 한 번에 (최대 256개)
+                    read = container->DequeueBatch(readBuffer.data(), readBuffer.size() * sizeof(int));
+                    TEST_ASSERT(read % sizeof(int) == 0, "DequeueBatch가 int 중간에서 끊김");
+
+                    if (read == 0)
+                    {
+                        continue;
+                    }
+                }
+                else if (framed)
+                {
+                    // 메시지 단위 읽기: 소비자가 하나면 PeekMessageSpan+ConsumeMessage 제로 카피 경로도 번갈아 사용
+                    if (consumerCount == 1 && sizeDis(gen) % 2 == 0)
+                    {
+                        RingSpans spans = container->PeekMessageSpan();
+                        if (spans.count > 0)
+                        {
+                            CopyFromSpans(spans, readBuffer.data(), (std::min)(spans.totalSize, readBuffer.size() * sizeof(int)));
+                            read = container->ConsumeMessage();
+                            TEST_ASSERT(read == spans.totalSize, "ConsumeMessage 크기가 PeekMessageSpan과 다름");
+                        }
+                    }
+                    else
+                    {
+                        read = container->DequeueMessage(readBuffer.data(), readBuffer.size() * sizeof(int));
+                    }
+
+                    if (read == 0)
+                    {
+                        continue;
+                    }
+
+                    // 메시지 경계 검증: 크기는 1~32개 int, 내용은 한 생산자의 연속된 숫자 묶음
+                    TEST_ASSERT(read % sizeof(int) == 0 && read <= readBuffer.size() * sizeof(int), "메시지 크기 손상: " + std::to_string(read));
+                    for (size_t i = 1; i < read / sizeof(int); i++)
+                    {
+                        TEST_ASSERT(readBuffer[i] == readBuffer[i - 1] + 1, "메시지 경계 위반: 묶음 내부 숫자가 연속되지 않음");
+                    }
+                }
+                else
+                {
+                    // 랜덤 크기로 Dequeue 시도 (8~256바이트)
+                    int requestCount = sizeDis(gen);
+                    size_t requestSize = requestCount * sizeof(int);
+                    read = container->Dequeue(readBuffer.data(), requestSize);
+
+                    // All-or-Nothing: 0 또는 requestSize만 가능
+                    TEST_ASSERT(read == 0 || read == requestSize, "All-or-Nothing 위반: 부분 읽기 " + std::to_string(read) + " 발생");
+
+                    if (read == 0)
+                    {
+                        continue;
+                    }
                 }
 
                 // 요청한 만큼 read 됨
@@ -564,14 +948,67 @@ void RunProducerConsumerTest(
                     TEST_ASSERT(success, "중복 Dequeue 발견!");
                 }
                 totalDequeued += numCount;
+                myDequeued += numCount;
             }
+            perConsumerDequeued[consumerId] = myDequeued;
             ++consumersCompleted;
         });
     }
 
+    // 관찰자 스레드 생성: 소비자가 모두 끝날 때까지 맨 앞 5개 int(Framed면 헤더 + 4개)를 엿보고 내용이 말이 되는지 확인
+    // 일관되지 않은 스냅샷(복사 도중 소비자가 지나가고 생산자가 덮어쓴 값)이면 범위/연속성 검사에 걸림
+    std::vector<std::thread> observers;
+    for (int observerId = 0; observerId < observerCount; observerId++)
+    {
+        observers.emplace_back([&]()
+        {
+            int peekBuffer[5];
+            uint64_t myPeeks = 0;
+
+            while (consumersCompleted < consumerCount)
+            {
+                size_t peeked = (observerMode == ObserverPeekMode::Locked)
+                    ? container->Peek(peekBuffer, sizeof(peekBuffer))
+                    : container->TryPeekConsistent(peekBuffer, sizeof(peekBuffer));
+
+                if (peeked != 0)
+                {
+                    TEST_ASSERT(peeked == sizeof(peekBuffer), "관찰자 Peek 크기 불일치");
+
+                    if (framed)
+                    {
+                        // 맨 앞은 항상 메시지 경계: 헤더(본문 길이) + 본문 앞부분이 한 묶음의 연속된 숫자
+                        uint32_t length = static_cast<uint32_t>(peekBuffer[0]);
+                        TEST_ASSERT(length > 0 && length % sizeof(int) == 0 && length <= 32 * sizeof(int), "관찰자가 본 메시지 헤더 손상");
+                        size_t count = (std::min)(length / sizeof(int), (size_t)4);
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            TEST_ASSERT(peekBuffer[1 + i] >= 0 && peekBuffer[1 + i] < TOTAL_NUMBERS, "관찰자가 범위 밖 숫자를 봄");
+                            TEST_ASSERT(i == 0 || peekBuffer[1 + i] == peekBuffer[i] + 1, "관찰자가 본 메시지 본문이 연속되지 않음");
+                        }
+                    }
+                    else
+                    {
+                        for (int i = 0; i < 5; i++)
+                        {
+                            TEST_ASSERT(peekBuffer[i] >= 0 && peekBuffer[i] < TOTAL_NUMBERS, "관찰자가 범위 밖 숫자를 봄");
+                        }
+                    }
+                    myPeeks++;
+                }
+
+                // 모니터링 스레드처럼 일정 간격으로 표본을 뜸 (두 방식이 같은 빈도로 엿보도록)
+                std::this_thread::sleep_for(std::chrono::microseconds(TestConfig::OBSERVER_PEEK_INTERVAL_US));
+            }
+            totalObserverPeeks += myPeeks;
+        });
+    }
+
     for (auto& t : producers) t.join();
     allProducersDone = true;
     for (auto& t : consumers) t.join();
+    auto workEndTime = std::chrono::steady_clock::now();
+    for (auto& t : observers) t.join();
 
     // 스레드 종료 "전에" 플래그 설정
     pauseProgress = true;
@@ -587,6 +1024,14 @@ void RunProducerConsumerTest(
     auto endTime = std::chrono::steady_clock::now();
     auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime).count();
 
+    // 처리량 계산은 진행률 출력 대기 시간(600ms x 2)을 제외한 실제 작업 시간 기준
+    auto workElapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(workEndTime - startTime).count();
+    double throughputMB = 0.0;
+    if (workElapsedMs > 0)
+    {
+        throughputMB = (double)TOTAL_NUMBERS * sizeof(int) / (1024.0 * 1024.0) / (workElapsedMs / 1000.0);
+    }
+
     // 최종 검증
     std::cout << "\n========================================" << std::endl;
     std::cout << "[최종 검증]" << std::endl;
@@ -622,15 +1067,74 @@ void RunProducerConsumerTest(
 
     TEST_ASSERT(container->GetDataSize() == 0, "버퍼가 완전히 비워지지 않음");
     std::cout << "  > 버퍼 완전히 비워짐" << std::endl;
+    std::cout << "  > 처리량: " << throughputMB << " MB/s (" << workElapsedMs << " ms)" << std::endl;
+
+    result.throughputMB = throughputMB;
+    result.lockAcquireCount = GetLockAcquireCount(container->GetLockPolicy());
+    result.consumerFairness = CalcJainFairness(perConsumerDequeued);
+    result.observerPeeks = totalObserverPeeks;
+    if (observerCount > 0)
+    {
+        std::cout << "  > 관찰자 " << observerCount << "개 ("
+            << (observerMode == ObserverPeekMode::Locked ? "Peek" : "TryPeekConsistent") << "): 성공한 Peek " << result.observerPeeks << " 회" << std::endl;
+    }
+    if (result.lockAcquireCount > 0)
+    {
+        std::cout << "  > 락 획득: " << result.lockAcquireCount << " 회 ("
+            << (double)result.lockAcquireCount / (TOTAL_NUMBERS * sizeof(int)) << " 회/바이트)" << std::endl;
+    }
 
     std::cout << "\n[PASS] Producer " << producerCount << " / Consumer " << consumerCount << " 완료 (소요: " << elapsed << "초)" << std::endl;
     std::cout << "========================================" << std::endl;
 
     g_testCount++;
     std::this_thread::sleep_for(std::chrono::seconds(5));
+    return result;
 }
 
 // 다중 조합 테스트 실행
+// TryPeekConsistent의 seqlock 검증용: 소비자가 읽기 위치를 공개하는 구간(BeginReadPublish ~ EndReadPublish)을 단계별로 호출
+template<typename RingType>
+class CSeqlockProbeRing : public RingType
+{
+public:
+    using RingType::RingType;
+    using RingType::BeginReadPublish;
+    using RingType::StoreReadPos;
+    using RingType::EndReadPublish;
+};
+
+// 관찰자가 (새 순번 + 옛 읽기 위치)를 읽고, 그 사이 소비자가 위치를 옮기고 생산자가 그 자리를 덮는 순서를 강제로 재현
+// 공개 구간 안에서는 어떤 단계에서든 TryPeekConsistent가 실패해야 하고, 끝난 뒤에는 새 맨 앞을 봐야 함
+// (스레드 경쟁으로는 이 틈을 거의 맞추지 못하므로 관찰자 스레드 테스트와 별도로 단계별 확인)
+void RunSeqlockInterleavingTest()
+{
+    CSeqlockProbeRing<CRingBufferST> ring(16);  // 사용 가능 15바이트
+    uint64_t first = 0xAAAAAAAAAAAAAAAAull;
+    uint64_t second = 0xBBBBBBBBBBBBBBBBull;
+    char overwrite[7];
+    std::memset(overwrite, 0xCC, sizeof(overwrite));
+    uint64_t peeked = 0;
+
+    TEST_ASSERT(ring.Enqueue(&first, sizeof(first)) == sizeof(first), "Enqueue 실패");
+    TEST_ASSERT(ring.TryPeekConsistent(&peeked, sizeof(peeked)) == sizeof(peeked) && peeked == first, "공개 전 TryPeekConsistent 실패");
+
+    // 소비자: first를 다 읽고 공개 시작 (순번 홀수, 위치는 아직 0)
+    ring.BeginReadPublish();
+    TEST_ASSERT(ring.TryPeekConsistent(&peeked, sizeof(peeked)) == 0, "공개 도중(위치 저장 전) TryPeekConsistent가 성공함");
+
+    // 소비자: 위치 8 저장 -> 생산자: 8~15, 0~6에 기록해서 first 자리를 덮음
+    ring.StoreReadPos(8);
+    TEST_ASSERT(ring.Enqueue(&second, sizeof(second)) == sizeof(second), "Enqueue 실패");
+    TEST_ASSERT(ring.Enqueue(overwrite, sizeof(overwrite)) == sizeof(overwrite), "덮어쓰기 Enqueue 실패");
+    TEST_ASSERT(ring.TryPeekConsistent(&peeked, sizeof(peeked)) == 0, "공개 도중(덮어쓴 뒤) TryPeekConsistent가 성공함");
+
+    // 공개 끝: 새 맨 앞(second)을 봄
+    ring.EndReadPublish();
+    TEST_ASSERT(ring.TryPeekConsistent(&peeked, sizeof(peeked)) == sizeof(peeked) && peeked == second, "공개 후 TryPeekConsistent가 새 맨 앞을 보지 못함");
+    g_testCount++;
+}
+
 void Test_ProducerConsumer()
 {
     // 다양한 스레드 조합 (대칭 + 비대칭)
@@ -646,6 +1150,10 @@ void Test_ProducerConsumer()
     };
 
     std::vector<std::string> completedLines;
+    double mtThroughput1to1 = 0.0;
+
+    RunSeqlockInterleavingTest();
+    completedLines.push_back("[seqlock] TryPeekConsistent 공개 구간 끼어들기 재현 통과");
 
     for (size_t i = 0; i < threadConfigs.size(); i++)
     {
@@ -655,16 +1163,97 @@ void Test_ProducerConsumer()
         // 진행 중 조합 라인
         std::string runningLine = "[" + std::to_string(producerCount) + "-" + std::to_string(consumerCount) + "] 조합 테스트 진행 중..";
 
-        RunProducerConsumerTest(
+        double throughput = RunProducerConsumerTest<CRingBufferMT>(
             producerCount,
             consumerCount,
             TestConfig::NUMBERS_PER_THREAD,
             completedLines,
             runningLine
-        );
+        ).throughputMB;
+
+        if (producerCount == 1 && consumerCount == 1)
+            mtThroughput1to1 = throughput;
 
         // 완료된 조합을 상단에 누적
-        completedLines.push_back("[" + std::to_string(producerCount) + "-" + std::to_string(consumerCount) + "] 조합 테스트 완료");
+        completedLines.push_back("[" + std::to_string(producerCount) + "-" + std::to_string(consumerCount) + "] 조합 테스트 완료 ("
+            + std::to_string((int)throughput) + " MB/s)");
+    }
+
+    // SPSC lock-free 버전: 1:1 조합만 유효
+    double spscThroughput1to1 = RunProducerConsumerTest<CRingBufferSPSC>(
+        1,
+        1,
+        TestConfig::NUMBERS_PER_THREAD,
+        completedLines,
+        "[1-1 SPSC] 조합 테스트 진행 중.."
+    ).throughputMB;
+    completedLines.push_back("[1-1 SPSC] 조합 테스트 완료 (" + std::to_string((int)spscThroughput1to1) + " MB/s)");
+
+    // 관찰자 Peek 비교: 모니터링 스레드가 계속 엿보는 동안 생산자/소비자 처리량이 떨어지는지
+    // MT는 관찰자 없음 / 락 Peek / TryPeekConsistent, SPSC는 락 Peek를 쓸 수 없으므로 (소비자 전용) 없음 / TryPeekConsistent
+    struct ObserverRun
+    {
+        bool spsc;
+        int observerCount;
+        ObserverPeekMode observerMode;
+        const char* name;
+    };
+    const int OBSERVERS = 4;
+    std::vector<ObserverRun> observerRuns = {
+        { false, 0, ObserverPeekMode::Consistent, "[4-4] 관찰자 없음" },
+        { false, OBSERVERS, ObserverPeekMode::Locked, "[4-4] 관찰자 4 (Peek)" },
+        { false, OBSERVERS, ObserverPeekMode::Consistent, "[4-4] 관찰자 4 (TryPeekConsistent)" },
+        { true, 0, ObserverPeekMode::Consistent, "[1-1 SPSC] 관찰자 없음" },
+        { true, OBSERVERS, ObserverPeekMode::Consistent, "[1-1 SPSC] 관찰자 4 (TryPeekConsistent)" },
+    };
+    std::vector<std::string> observerLines;
+    double observerBaseline = 0.0;
+
+    for (size_t i = 0; i < observerRuns.size(); i++)
+    {
+        const ObserverRun& run = observerRuns[i];
+        std::string name = run.name;
+        ProducerConsumerResult result = run.spsc
+            ? RunProducerConsumerTest<CRingBufferSPSC>(1, 1, TestConfig::NUMBERS_PER_THREAD, completedLines, name + " 진행 중..",
+                ProducerConsumerMode::Bytes, run.observerCount, run.observerMode)
+            : RunProducerConsumerTest<CRingBufferMT>(4, 4, TestConfig::NUMBERS_PER_THREAD, completedLines, name + " 진행 중..",
+                ProducerConsumerMode::Bytes, run.observerCount, run.observerMode);
+        completedLines.push_back(name + " 완료 (" + std::to_string((int)result.throughputMB) + " MB/s)");
+
+        if (run.observerCount == 0)
+            observerBaseline = result.throughputMB;
+
+        std::string line = "  " + name + ": " + std::to_string((int)result.throughputMB) + " MB/s";
+        if (run.observerCount > 0 && observerBaseline > 0.0)
+            line += " (관찰자 없음 대비 " + std::to_string(result.throughputMB / observerBaseline) + " 배, Peek " + std::to_string(result.observerPeeks) + " 회)";
+        observerLines.push_back(line);
+    }
+
+    // 락 획득 횟수 벤치마크: 묶음마다 Enqueue/Dequeue vs EnqueueV/DequeueBatch
+    // 실패한(공간/데이터 부족) 시도도 락을 잡으므로 함께 집계됨
+    using CRingBufferCountedMT = CRingBufferT<CountingLock<MutexLock>>;
+    std::vector<std::pair<int, int>> lockConfigs = { {1, 1}, {4, 4}, {8, 1} };
+    std::vector<std::string> lockLines;
+
+    for (size_t i = 0; i < lockConfigs.size(); i++)
+    {
+        int producerCount = lockConfigs[i].first;
+        int consumerCount = lockConfigs[i].second;
+        std::string name = "[" + std::to_string(producerCount) + "-" + std::to_string(consumerCount) + "]";
+        double totalBytes = (double)TestConfig::NUMBERS_PER_THREAD * producerCount * sizeof(int);
+
+        ProducerConsumerResult before = RunProducerConsumerTest<CRingBufferCountedMT>(
+            producerCount, consumerCount, TestConfig::NUMBERS_PER_THREAD, completedLines, name + " 락 횟수 (Enqueue/Dequeue) 측정 중..");
+        completedLines.push_back(name + " 락 횟수 (Enqueue/Dequeue) 측정 완료");
+
+        ProducerConsumerResult after = RunProducerConsumerTest<CRingBufferCountedMT>(
+            producerCount, consumerCount, TestConfig::NUMBERS_PER_THREAD, completedLines, name + " 락 횟수 (EnqueueV/DequeueBatch) 측정 중..",
+            ProducerConsumerMode::Batch);
+        completedLines.push_back(name + " 락 횟수 (EnqueueV/DequeueBatch) 측정 완료");
+
+        lockLines.push_back("  " + name + " 락/KB: " + std::to_string(before.lockAcquireCount / totalBytes * 1024.0)
+            + " -> " + std::to_string(after.lockAcquireCount / totalBytes * 1024.0)
+            + ", MB/s: " + std::to_string(before.throughputMB) + " -> " + std::to_string(after.throughputMB));
     }
 
     // 마지막 전체 완료 출력
@@ -680,7 +1269,80 @@ void Test_ProducerConsumer()
     }
     std::cout << "\n========================================" << std::endl;
     std::cout << "[Phase 2-1] 모든 조합 테스트 완료!" << std::endl;
-    std::cout << "  - 총 " << threadConfigs.size() << "가지 조합 성공" << std::endl;
+    std::cout << "  - 총 " << threadConfigs.size() + 1 + observerRuns.size() + lockConfigs.size() * 2 << "가지 조합 성공" << std::endl;
+    std::cout << "\n[1:1 처리량 비교]" << std::endl;
+    std::cout << "  - CRingBufferMT   : " << mtThroughput1to1 << " MB/s" << std::endl;
+    std::cout << "  - CRingBufferSPSC : " << spscThroughput1to1 << " MB/s" << std::endl;
+    if (mtThroughput1to1 > 0.0)
+    {
+        std::cout << "  - SPSC / MT       : " << spscThroughput1to1 / mtThroughput1to1 << " 배" << std::endl;
+    }
+    std::cout << "\n[관찰자 Peek 비교 (관찰자 스레드가 계속 엿보는 동안의 처리량)]" << std::endl;
+    for (size_t i = 0; i < observerLines.size(); ++i)
+    {
+        std::cout << observerLines[i] << std::endl;
+    }
+    std::cout << "\n[락 획득 횟수 비교 (Enqueue/Dequeue -> EnqueueV/DequeueBatch)]" << std::endl;
+    for (size_t i = 0; i < lockLines.size(); ++i)
+    {
+        std::cout << lockLines[i] << std::endl;
+    }
+    std::cout << "========================================" << std::endl;
+}
+
+// 메시지(프레임) 모드 Producer-Consumer: 숫자 묶음 하나 = 메시지 하나
+// 동시성 하에서 메시지 경계가 깨지지 않는지 (부분 메시지가 보이지 않는지) 검증
+void Test_FramedProducerConsumer()
+{
+    std::vector<std::pair<int, int>> threadConfigs = {
+        {1, 1},
+        {2, 2},
+        {4, 4},
+        {8, 8},
+        {1, 8},
+        {8, 1},
+        {2, 6},
+        {6, 2}
+    };
+
+    std::vector<std::string> completedLines;
+
+    for (size_t i = 0; i < threadConfigs.size(); i++)
+    {
+        int producerCount = threadConfigs[i].first;
+        int consumerCount = threadConfigs[i].second;
+        std::string name = "[" + std::to_string(producerCount) + "-" + std::to_string(consumerCount) + " Framed]";
+
+        double throughput = RunProducerConsumerTest<CRingBufferMT>(
+            producerCount, consumerCount, TestConfig::NUMBERS_PER_THREAD, completedLines, name + " 조합 테스트 진행 중..",
+            ProducerConsumerMode::Framed).throughputMB;
+        completedLines.push_back(name + " 조합 테스트 완료 (" + std::to_string((int)throughput) + " MB/s)");
+    }
+
+    double spscThroughput = RunProducerConsumerTest<CRingBufferSPSC>(
+        1, 1, TestConfig::NUMBERS_PER_THREAD, completedLines, "[1-1 Framed SPSC] 조합 테스트 진행 중..",
+        ProducerConsumerMode::Framed).throughputMB;
+    completedLines.push_back("[1-1 Framed SPSC] 조합 테스트 완료 (" + std::to_string((int)spscThroughput) + " MB/s)");
+
+    // 관찰자가 메시지 경계에서 엿본 헤더 + 본문이 항상 한 메시지의 것인지 (락 없는 TryPeekConsistent)
+    double observedThroughput = RunProducerConsumerTest<CRingBufferMT>(
+        4, 4, TestConfig::NUMBERS_PER_THREAD, completedLines, "[4-4 Framed] 관찰자 4 (TryPeekConsistent) 진행 중..",
+        ProducerConsumerMode::Framed, 4, ObserverPeekMode::Consistent).throughputMB;
+    completedLines.push_back("[4-4 Framed] 관찰자 4 (TryPeekConsistent) 완료 (" + std::to_string((int)observedThroughput) + " MB/s)");
+
+#ifdef _WIN32
+    system("cls");
+#else
+    system("clear");
+#endif
+    std::cout << "========================================" << std::endl;
+    for (size_t i = 0; i < completedLines.size(); ++i)
+    {
+        std::cout << completedLines[i] << std::endl;
+    }
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Phase 2-1] 모든 메시지 모드 조합 테스트 완료!" << std::endl;
+    std::cout << "  - 총 " << threadConfigs.size() + 2 << "가지 조합 성공" << std::endl;
     std::cout << "========================================" << std::endl;
 }
 
@@ -692,16 +1354,31 @@ void Test_ProducerConsumer()
 // 모든 스레드가 동시에 1바이트씩 Enqueue/Dequeue 반복
 //=============================================================================
 
+struct HighContentionResult
+{
+    uint64_t opsPerSec;     // 처리량 (ops/sec)
+    double fairness;        // 스레드별 성공 작업 수의 Jain 공정성 지수 (생산자/소비자 각각 구한 뒤 낮은 쪽)
+};
+
 // 파라미터화된 고빈도 경합 테스트 함수
-void RunHighContentionTest(
+// RingType: CRingBufferMT 또는 CRecordRingMPMC (1바이트 레코드)
+template<typename RingType>
+HighContentionResult RunHighContentionTest(
     int threadCount,
     uint64_t opsPerThread,
     const std::vector<std::string>& completedLines,
     const std::string& runningLine)
 {
-    auto container = std::make_unique<CRingBufferMT>(1024);
+    auto container = std::make_unique<RingType>(1024);
+    if (!container->IsValid())
+    {
+        std::cout << "[ERROR] RingBuffer 할당 실패" << std::endl;
+        return HighContentionResult{};
+    }
+
     std::atomic<uint64_t> enqueueCount(0);
     std::atomic<uint64_t> dequeueCount(0);
+    std::vector<uint64_t> perThreadSuccess(threadCount, 0);
 
     // 진행률 출력 스레드
     std::atomic<bool> running(true);
@@ -747,6 +1424,7 @@ void RunHighContentionTest(
         threads.emplace_back([&, i]() {
             char byte = static_cast<char>(i);
             char readByte;
+            uint64_t mySuccess = 0;
 
             for (uint64_t j = 0; j < opsPerThread; j++)
             {
@@ -754,19 +1432,27 @@ void RunHighContentionTest(
                 if (i % 2 == 0)
                 {
                     if (container->Enqueue(&byte, 1) == 1)
+                    {
                         enqueueCount++;
+                        mySuccess++;
+                    }
                 }
                 // 홀수 스레드: Dequeue
                 else
                 {
                     if (container->Dequeue(&readByte, 1) == 1)
+                    {
                         dequeueCount++;
+                        mySuccess++;
+                    }
                 }
             }
+            perThreadSuccess[i] = mySuccess;
         });
     }
 
     for (auto& t : threads) t.join();
+    auto workEndTime = std::chrono::steady_clock::now();
 
     // 진행률 출력 중지
     pauseProgress = true;
@@ -774,9 +1460,14 @@ void RunHighContentionTest(
     running = false;
     progressThread.join();
 
-    auto endTime = std::chrono::steady_clock::now();
     auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-        endTime - startTime).count();
+        workEndTime - startTime).count();
+
+    // 남은 데이터를 모두 꺼내 Enqueue 성공 수 = Dequeue 성공 수 + 잔여 수 확인
+    uint64_t remainCount = 0;
+    char drainByte;
+    while (container->Dequeue(&drainByte, 1) == 1)
+        remainCount++;
 
     // 최종 검증
     std::cout << "\n========================================" << std::endl;
@@ -787,12 +1478,29 @@ void RunHighContentionTest(
     std::cout << "  > 총 성공 작업: " << totalSuccess << " 개" << std::endl;
     std::cout << "  > Enqueue 성공: " << enqueueCount << " 개" << std::endl;
     std::cout << "  > Dequeue 성공: " << dequeueCount << " 개" << std::endl;
+    std::cout << "  > 잔여 데이터: " << remainCount << " 개" << std::endl;
     std::cout << "  > 소요 시간: " << elapsed << " ms" << std::endl;
-    
+    TEST_ASSERT(enqueueCount == dequeueCount + remainCount, "Enqueue 성공 수와 Dequeue 성공 수 + 잔여 수 불일치");
+
+    HighContentionResult result = {};
     if (elapsed > 0)
     {
-        std::cout << "  > 처리량: " << (totalSuccess * 1000 / elapsed) << " ops/sec" << std::endl;
+        result.opsPerSec = totalSuccess * 1000 / elapsed;
+        std::cout << "  > 처리량: " << result.opsPerSec << " ops/sec" << std::endl;
+    }
+
+    // 생산자끼리, 소비자끼리 비교 (역할별 성공률은 원래 다르므로 섞지 않음)
+    std::vector<uint64_t> producerSuccess;
+    std::vector<uint64_t> consumerSuccess;
+    for (int i = 0; i < threadCount; i++)
+    {
+        if (i % 2 == 0)
+            producerSuccess.push_back(perThreadSuccess[i]);
+        else
+            consumerSuccess.push_back(perThreadSuccess[i]);
     }
+    result.fairness = (std::min)(CalcJainFairness(producerSuccess), CalcJainFairness(consumerSuccess));
+    std::cout << "  > 공정성 (Jain): " << result.fairness << std::endl;
 
     std::cout << "\n[PASS] " << threadCount << "개 스레드 고빈도 경합 완료 (소요: " 
               << elapsed / 1000.0 << "초)" << std::endl;
@@ -800,6 +1508,55 @@ void RunHighContentionTest(
 
     g_testCount++;
     std::this_thread::sleep_for(std::chrono::seconds(3));
+    return result;
+}
+
+// 슬롯이 몇 개뿐인 작은 MPMC 링: 가득 찰 때까지 넣고 모두 꺼내기를 여러 바퀴 반복
+// 슬롯 1개짜리 링은 두 번째 Enqueue가 미소비 레코드를 덮어쓰고 Dequeue가 멈췄음
+void RunRecordRingSmallCapacityTest()
+{
+    const size_t capacities[] = { 64, 100, 127, 128, 200 };
+    for (size_t capacity : capacities)
+    {
+        CRecordRingMPMC ring(capacity);
+        TEST_ASSERT(ring.IsValid(), "MPMC 링 생성 실패");
+        TEST_ASSERT(ring.GetSlotCount() >= 2, "MPMC 링 슬롯이 2개 미만");
+
+        uint32_t next = 0;
+        uint32_t expected = 0;
+        for (int lap = 0; lap < 8; lap++)
+        {
+            size_t stored = 0;
+            while (ring.Enqueue(&next, sizeof(next)) == sizeof(next))
+            {
+                next++;
+                stored++;
+            }
+            TEST_ASSERT(stored == ring.GetSlotCount(), "작은 MPMC 링에 슬롯 수만큼 들어가지 않음");
+
+            uint32_t value = 0;
+            for (size_t i = 0; i < stored; i++)
+            {
+                TEST_ASSERT(ring.Dequeue(&value, sizeof(value)) == sizeof(value), "작은 MPMC 링 Dequeue 실패");
+                TEST_ASSERT(value == expected, "작은 MPMC 링 레코드가 덮어써짐");
+                expected++;
+            }
+            TEST_ASSERT(ring.Dequeue(&value, sizeof(value)) == 0, "빈 MPMC 링에서 Dequeue 성공");
+        }
+
+        // 모든 슬롯을 차지하는 최대 크기 레코드
+        std::vector<char> record(ring.GetMaxRecordSize(), 'r');
+        std::vector<char> out(record.size());
+        TEST_ASSERT(ring.Enqueue(record.data(), record.size()) == record.size(), "최대 크기 레코드 Enqueue 실패");
+        TEST_ASSERT(ring.Enqueue(&next, sizeof(next)) == 0, "가득 찬 MPMC 링에 Enqueue 성공");
+        TEST_ASSERT(ring.Dequeue(out.data(), out.size()) == record.size() && out == record, "최대 크기 레코드 불일치");
+        TEST_ASSERT(ring.Dequeue(out.data(), out.size()) == 0, "빈 MPMC 링에서 Dequeue 성공");
+    }
+
+    TEST_ASSERT(!CRecordRingMPMC(CRecordRingMPMC::SLOT_SIZE - 1).IsValid(), "슬롯 하나보다 작은 용량이 허용됨");
+
+    std::cout << "[PASS] 작은 용량 MPMC 링 (64 ~ 200 바이트, 8바퀴)" << std::endl;
+    g_testCount++;
 }
 
 // 다중 스레드 조합 테스트 실행
@@ -810,6 +1567,8 @@ void Test_HighContentionFalseSharing()
     std::cout << "  - 각 스레드당 " << TestConfig::HIGH_CONTENTION_OPS_PER_THREAD / 1'000'000 << "백만 번 작업" << std::endl;
     std::cout << "========================================" << std::endl;
 
+    RunRecordRingSmallCapacityTest();
+
     // 다양한 스레드 조합
     std::vector<int> threadCounts = {
         2,    // 최소 (Producer 1, Consumer 1)
@@ -820,6 +1579,8 @@ void Test_HighContentionFalseSharing()
     };
 
     std::vector<std::string> completedLines;
+    std::vector<uint64_t> mtThroughputs;
+    std::vector<uint64_t> mpmcThroughputs;
 
     for (size_t i = 0; i < threadCounts.size(); i++)
     {
@@ -828,15 +1589,31 @@ void Test_HighContentionFalseSharing()
         // 진행 중 라인
         std::string runningLine = "[" + std::to_string(threadCount) + "개 스레드] 고빈도 경합 테스트 진행 중..";
 
-        RunHighContentionTest(
+        uint64_t mtThroughput = RunHighContentionTest<CRingBufferMT>(
             threadCount,
             TestConfig::HIGH_CONTENTION_OPS_PER_THREAD,
             completedLines,
             runningLine
-        );
+        ).opsPerSec;
+        mtThroughputs.push_back(mtThroughput);
 
         // 완료된 조합을 상단에 누적
-        completedLines.push_back("[" + std::to_string(threadCount) + "개 스레드] 고빈도 경합 테스트 완료");
+        completedLines.push_back("[" + std::to_string(threadCount) + "개 스레드] 고빈도 경합 테스트 완료 ("
+            + std::to_string(mtThroughput) + " ops/sec)");
+
+        // 같은 조건으로 lock-free MPMC 레코드 링 실행
+        runningLine = "[" + std::to_string(threadCount) + "개 스레드 MPMC] 고빈도 경합 테스트 진행 중..";
+
+        uint64_t mpmcThroughput = RunHighContentionTest<CRecordRingMPMC>(
+            threadCount,
+            TestConfig::HIGH_CONTENTION_OPS_PER_THREAD,
+            completedLines,
+            runningLine
+        ).opsPerSec;
+        mpmcThroughputs.push_back(mpmcThroughput);
+
+        completedLines.push_back("[" + std::to_string(threadCount) + "개 스레드 MPMC] 고빈도 경합 테스트 완료 ("
+            + std::to_string(mpmcThroughput) + " ops/sec)");
     }
 
     // 마지막 전체 완료 출력
@@ -853,34 +1630,3974 @@ void Test_HighContentionFalseSharing()
     std::cout << "\n========================================" << std::endl;
     std::cout << "[Phase 2-2] 모든 고빈도 경합 테스트 완료!" << std::endl;
     std::cout << "  - 총 " << threadCounts.size() << "가지 스레드 조합 성공" << std::endl;
+    std::cout << "\n[처리량 비교 (ops/sec)]" << std::endl;
+    std::cout << "  스레드 | CRingBufferMT | CRecordRingMPMC" << std::endl;
+    for (size_t i = 0; i < threadCounts.size(); ++i)
+    {
+        std::cout << "  " << threadCounts[i] << " | " << mtThroughputs[i] << " | " << mpmcThroughputs[i] << std::endl;
+    }
     std::cout << "========================================" << std::endl;
 }
 
 //=============================================================================
-// 메뉴 출력
+// Phase 2-3: 멀티스레드 - Peek+Consume (PeekSpans 제로 카피) 정합성 테스트
+// 소비자는 PeekSpans()로 링 내부를 직접 읽고 Consume()으로 읽기 위치만 이동
+// 구간 데이터를 Peek() 복사본 및 생산자별 시퀀스와 대조
 //=============================================================================
-void PrintMenu()
+
+// 파라미터화된 Peek+Consume 테스트 함수
+template<typename RingType = CRingBufferMT>
+void RunPeekConsumeTest(
+    int producerCount,
+    int consumerCount,
+    int numbersPerThread,
+    const std::vector<std::string>& completedLines,
+    const std::string& runningLine)
 {
-    std::cout << "\n========================================" << std::endl;
-    std::cout << "  CRingBuffer 테스트 메뉴" << std::endl;
-    std::cout << "========================================" << std::endl;
-    std::cout << "[Phase 1: 기본 검증 - 단일 스레드]" << std::endl;
-    std::cout << "  1. 데이터 무결성 테스트 (1억 번)" << std::endl;
-    std::cout << "  2. 불변성 검증 테스트 (1억 번)" << std::endl;
-    std::cout << "  3. 경계 조건 테스트 (1억 번)" << std::endl;
-    std::cout << "  4. Phase 1 전체 실행" << std::endl;
-    std::cout << "\n[Phase 2: 멀티스레드 검증]" << std::endl;
-    std::cout << "  5. Producer-Consumer 테스트 (1억 바이트)" << std::endl;
-    std::cout << "  6. 고빈도 경합 테스트" << std::endl;
-    std::cout << "  7. Phase 2 전체 실행" << std::endl;
-    std::cout << "\n[전체]" << std::endl;
-    std::cout << "  8. 전체 테스트 실행 (Phase 1 + Phase 2)" << std::endl;
-    std::cout << "  0. 종료" << std::endl;
-    std::cout << "========================================" << std::endl;
-    std::cout << "선택: ";
-}
+    const int TOTAL_NUMBERS = numbersPerThread * producerCount;
+    std::atomic<uint64_t> totalEnqueued(0);
+    std::atomic<uint64_t> totalDequeued(0);
+    std::atomic<bool> allProducersDone(false);
 
-//=============================================================================
+    auto container = std::make_unique<RingType>(65536);
+    if (!container->IsValid())
+    {
+        std::cout << "[ERROR] RingBuffer 할당 실패" << std::endl;
+        return;
+    }
+
+    auto dequeueCheck = std::make_unique<std::atomic<int>[]>(TOTAL_NUMBERS);
+    for (int i = 0; i < TOTAL_NUMBERS; i++)
+        dequeueCheck[i] = 0;
+
+    // PeekSpans~Consume 구간은 소비자끼리 직렬화해야 함 (같은 구간을 두 소비자가 읽지 않도록)
+    std::mutex consumerLock;
+    std::vector<int> lastSeen(producerCount, -1); // 생산자별 마지막으로 확인한 숫자 (consumerLock 보호)
+    uint64_t wrapSpanCount = 0;                   // 2개 구간으로 나뉜 Peek 횟수 (consumerLock 보호)
+
+    // 진행률 출력 스레드
+    std::atomic<bool> running(true);
+    std::atomic<bool> pauseProgress(false);
+    std::thread progressThread([&]() {
+        while (running)
+        {
+            if (!pauseProgress)
+            {
+#ifdef _WIN32
+                system("cls");
+#else
+                system("clear");
+#endif
+                std::cout << "========================================" << std::endl;
+                std::cout << "[Phase 2-3] Peek+Consume 테스트" << std::endl;
+                std::cout << "========================================" << std::endl;
+                for (size_t j = 0; j < completedLines.size(); ++j)
+                {
+                    std::cout << completedLines[j] << std::endl;
+                }
+                std::cout << runningLine << std::endl;
+                double enqueueRate = (double)totalEnqueued / TOTAL_NUMBERS * 100.0;
+                double dequeueRate = (double)totalDequeued / TOTAL_NUMBERS * 100.0;
+                std::cout << "[진행률] Enqueue: " << enqueueRate << "%, Consume: " << dequeueRate << "%\n";
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        }
+    });
+
+    std::random_device rd;
+    std::vector<std::thread> producers;
+    std::vector<std::thread> consumers;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    // Producer 스레드 생성 (Producer-Consumer 테스트와 동일)
+    for (int threadId = 0; threadId < producerCount; threadId++)
+    {
+        producers.emplace_back([&, threadId]()
+        {
+            std::mt19937 gen(rd() + threadId);
+            std::uniform_int_distribution<> sizeDis(1, 32);
+
+            int startNum = threadId * numbersPerThread;
+            int endNum = startNum + numbersPerThread;
+            int currentNum = startNum;
+            std::vector<int> batch;
+
+            while (currentNum < endNum)
+            {
+                int batchSize = (std::min)(sizeDis(gen), endNum - currentNum);
+                batch.clear();
+
+                for (int i = 0; i < batchSize; i++)
+                {
+                    batch.push_back(currentNum + i);
+                }
+
+                size_t totalSize = batch.size() * sizeof(int);
+                size_t written = 0;
+
+                while (written == 0)
+                {
+                    written = container->Enqueue(batch.data(), totalSize);
+                }
+
+                TEST_ASSERT(written == totalSize, "Enqueue 크기 불일치");
+                currentNum += batchSize;
+                totalEnqueued += batchSize;
+            }
+        });
+    }
+
+    // Consumer 스레드 생성
+    for (int consumerId = 0; consumerId < consumerCount; consumerId++)
+    {
+        consumers.emplace_back([&, consumerId]()
+        {
+            std::mt19937 gen(rd() + 1000 + consumerId);
+            std::uniform_int_distribution<> sizeDis(1, 32);
+            std::vector<int> spanBuffer(32);
+            std::vector<int> peekBuffer(32);
+
+            while (true)
+            {
+                if (allProducersDone && totalDequeued >= TOTAL_NUMBERS)
+                {
+                    break;
+                }
+
+                int requestCount = sizeDis(gen);
+
+                std::lock_guard<std::mutex> guard(consumerLock);
+
+                // 1. 복사 없이 읽기 가능한 구간 획득
+                RingSpans spans = container->PeekSpans();
+                TEST_ASSERT(spans.totalSize % sizeof(int) == 0, "PeekSpans 크기가 int 단위가 아님");
+
+                size_t numCount = (std::min)((size_t)requestCount, spans.totalSize / sizeof(int));
+                if (numCount == 0)
+                {
+                    continue;
+                }
+
+                size_t bytes = numCount * sizeof(int);
+                if (spans.count == 2 && spans.vec[0].iov_len < bytes)
+                    wrapSpanCount++;
+
+                // 2. 구간 데이터와 Peek() 복사본 대조
+                CopyFromSpans(spans, spanBuffer.data(), bytes);
+                size_t peeked = container->Peek(peekBuffer.data(), bytes);
+                TEST_ASSERT(peeked == bytes, "Peek 크기 불일치");
+                TEST_ASSERT(std::memcmp(spanBuffer.data(), peekBuffer.data(), bytes) == 0, "PeekSpans 데이터가 Peek과 다름");
+
+                // 3. 시퀀스 검증: 범위, 중복, 생산자별 순서
+                for (size_t i = 0; i < numCount; i++)
+                {
+                    int num = spanBuffer[i];
+                    TEST_ASSERT(num >= 0 && num < TOTAL_NUMBERS, "범위 초과 숫자 발견");
+
+                    int producerId = num / numbersPerThread;
+                    TEST_ASSERT(num == lastSeen[producerId] + 1 || (lastSeen[producerId] == -1 && num == producerId * numbersPerThread),
+                        "생산자별 시퀀스 순서 위반");
+                    lastSeen[producerId] = num;
+
+                    int expected = 0;
+                    bool success = dequeueCheck[num].compare_exchange_strong(expected, 1);
+                    TEST_ASSERT(success, "중복 Consume 발견!");
+                }
+
+                // 4. 읽기 위치만 이동
+                size_t consumed = container->Consume(bytes);
+                TEST_ASSERT(consumed == bytes, "Consume 크기 불일치");
+                totalDequeued += numCount;
+            }
+        });
+    }
+
+    for (auto& t : producers) t.join();
+    allProducersDone = true;
+    for (auto& t : consumers) t.join();
+
+    pauseProgress = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    running = false;
+    progressThread.join();
+
+    auto endTime = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime).count();
+
+    // 최종 검증
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[최종 검증]" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TEST_ASSERT(totalEnqueued == TOTAL_NUMBERS, "Enqueue 개수 불일치");
+    TEST_ASSERT(totalDequeued == TOTAL_NUMBERS, "Consume 개수 불일치");
+    std::cout << "  > Enqueue/Consume 개수 일치: " << TOTAL_NUMBERS << " 개" << std::endl;
+
+    int missingCount = 0;
+    for (int i = 0; i < TOTAL_NUMBERS; i++)
+    {
+        if (dequeueCheck[i] == 0)
+        {
+            missingCount++;
+        }
+    }
+    TEST_ASSERT(missingCount == 0, "누락된 숫자 발견");
+    std::cout << "  > 모든 숫자 정확히 1번씩, 생산자별 순서대로 처리 완료" << std::endl;
+    std::cout << "  > wrap 지점에 걸친 구간 읽기: " << wrapSpanCount << " 회" << std::endl;
+
+    TEST_ASSERT(container->GetDataSize() == 0, "버퍼가 완전히 비워지지 않음");
+    std::cout << "  > 버퍼 완전히 비워짐" << std::endl;
+
+    std::cout << "\n[PASS] Producer " << producerCount << " / Consumer " << consumerCount << " Peek+Consume 완료 (소요: " << elapsed << "초)" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    g_testCount++;
+    std::this_thread::sleep_for(std::chrono::seconds(3));
+}
+
+// 다중 조합 Peek+Consume 테스트 실행
+void Test_PeekConsume()
+{
+    std::vector<std::pair<int, int>> threadConfigs = {
+        {1, 1},
+        {2, 2},
+        {4, 4},
+        {8, 8},
+        {1, 8},
+        {8, 1},
+        {2, 6},
+        {6, 2}
+    };
+
+    std::vector<std::string> completedLines;
+
+    for (size_t i = 0; i < threadConfigs.size(); i++)
+    {
+        int producerCount = threadConfigs[i].first;
+        int consumerCount = threadConfigs[i].second;
+
+        std::string runningLine = "[" + std::to_string(producerCount) + "-" + std::to_string(consumerCount) + "] Peek+Consume 테스트 진행 중..";
+
+        RunPeekConsumeTest(
+            producerCount,
+            consumerCount,
+            TestConfig::PEEK_CONSUME_PER_THREAD,
+            completedLines,
+            runningLine
+        );
+
+        completedLines.push_back("[" + std::to_string(producerCount) + "-" + std::to_string(consumerCount) + "] Peek+Consume 테스트 완료");
+    }
+
+#ifdef _WIN32
+    system("cls");
+#else
+    system("clear");
+#endif
+    std::cout << "========================================" << std::endl;
+    for (size_t i = 0; i < completedLines.size(); ++i)
+    {
+        std::cout << completedLines[i] << std::endl;
+    }
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Phase 2-3] 모든 Peek+Consume 테스트 완료!" << std::endl;
+    std::cout << "  - 총 " << threadConfigs.size() << "가지 조합 성공" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 가상 메모리 미러링 저장소(MirroredStorage) 검증
+// 기존 Phase 1-1, 1-2, 2-1을 미러링 버퍼로 다시 실행하고 wrap 지점 연속성 확인
+//=============================================================================
+void Test_MirroredStorage()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Mirror] 미러링 저장소 테스트 시작" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    auto container = std::make_unique<CRingBufferMirrorST>(4096);
+    if (!container->IsValid())
+    {
+        std::cout << "[ERROR] 미러링 버퍼 할당 실패 (지원하지 않는 OS이거나 매핑 실패)" << std::endl;
+        return;
+    }
+
+    const size_t capacity = container->GetCapacity();
+    std::cout << "  - 용량 (페이지 단위 올림): " << capacity << " 바이트" << std::endl;
+
+    // 1. 두 번째 매핑이 첫 번째 매핑과 같은 메모리인지, wrap 지점에서도 한 구간으로 보이는지 확인
+    {
+        std::vector<char> data(capacity - 1);
+        std::vector<char> readData(capacity - 1);
+        const uint64_t ITERATIONS = TestConfig::BOUNDARY_ITERATIONS_PER_SCENARIO;
+
+        for (uint64_t i = 0; i < ITERATIONS; i++)
+        {
+            g_totalIterations = i;
+            PrintProgress("미러링 Wrap", i, ITERATIONS);
+
+            // 읽기/쓰기 위치를 매번 옮겨 경계 전후를 모두 확인
+            size_t shift = static_cast<size_t>(i % capacity);
+            if (shift > 0)
+            {
+                container->Enqueue(data.data(), shift);
+                container->Clear();
+            }
+
+            size_t size = static_cast<size_t>(i * 7 % (capacity - 1)) + 1;
+            for (size_t j = 0; j < size; j++)
+                data[j] = static_cast<char>(i + j);
+
+            RingSpans writeSpans = container->ReserveWrite(size);
+            TEST_ASSERT(writeSpans.count == 1 && writeSpans.vec[0].iov_len == size, "미러링 ReserveWrite가 연속 구간이 아님");
+            std::memcpy(writeSpans.vec[0].iov_base, data.data(), size);
+            TEST_ASSERT(container->CommitWrite(size) == size, "미러링 CommitWrite 실패");
+
+            RingSpans readSpans = container->PeekSpans();
+            TEST_ASSERT(readSpans.count == 1 && readSpans.totalSize == size, "미러링 PeekSpans가 연속 구간이 아님");
+            TEST_ASSERT(std::memcmp(readSpans.vec[0].iov_base, data.data(), size) == 0, "미러링 구간 데이터 손상");
+
+            size_t read = container->Dequeue(readData.data(), size);
+            TEST_ASSERT(read == size, "미러링 Dequeue 실패");
+            TEST_ASSERT(std::memcmp(readData.data(), data.data(), size) == 0, "미러링 Dequeue 데이터 손상");
+        }
+        std::cout << "  > wrap 지점 연속 구간 검증 완료" << std::endl;
+    }
+
+    // 2. 기존 Phase 1 테스트를 미러링 버퍼로 실행
+    Test_DataIntegrity<CRingBufferMirrorST>("CRingBufferMirrorST");
+    Test_Invariants<CRingBufferMirrorST>("CRingBufferMirrorST");
+
+    // 3. 기존 Phase 2-1 테스트를 미러링 버퍼로 실행
+    std::vector<std::pair<int, int>> threadConfigs = {
+        {1, 1},
+        {4, 4},
+        {8, 1},
+        {1, 8}
+    };
+
+    std::vector<std::string> completedLines;
+    for (size_t i = 0; i < threadConfigs.size(); i++)
+    {
+        int producerCount = threadConfigs[i].first;
+        int consumerCount = threadConfigs[i].second;
+        std::string name = "[" + std::to_string(producerCount) + "-" + std::to_string(consumerCount) + " Mirror]";
+
+        double throughput = RunProducerConsumerTest<CRingBufferMirrorMT>(
+            producerCount, consumerCount, TestConfig::NUMBERS_PER_THREAD, completedLines, name + " 조합 테스트 진행 중..").throughputMB;
+        completedLines.push_back(name + " 조합 테스트 완료 (" + std::to_string((int)throughput) + " MB/s)");
+    }
+
+    double spscThroughput = RunProducerConsumerTest<CRingBufferMirrorSPSC>(
+        1, 1, TestConfig::NUMBERS_PER_THREAD, completedLines, "[1-1 Mirror SPSC] 조합 테스트 진행 중..").throughputMB;
+    completedLines.push_back("[1-1 Mirror SPSC] 조합 테스트 완료 (" + std::to_string((int)spscThroughput) + " MB/s)");
+
+    std::cout << "\n========================================" << std::endl;
+    for (size_t i = 0; i < completedLines.size(); ++i)
+    {
+        std::cout << completedLines[i] << std::endl;
+    }
+    std::cout << "[PASS] 미러링 저장소 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    g_testCount++;
+}
+
+//=============================================================================
+// Phase 2-4: 블로킹 API (EnqueueWait/DequeueWait) 검증
+// 타임아웃/깨우기 동작을 확인하고, 저빈도 생산자 환경에서
+// 재시도 루프(Enqueue/Dequeue) 대비 소비자 CPU 사용 시간을 비교
+//=============================================================================
+
+// 생산자가 LOW_RATE_INTERVAL_US 간격으로 숫자를 하나씩 보내고 소비자가 받음
+// blocking: true면 EnqueueWait/DequeueWait, false면 실패 시 바로 재시도
+// 반환값: 소비자 스레드들의 CPU 사용 시간 합 (ms)
+template<typename RingType>
+double RunLowRateTest(int producerCount, int consumerCount, bool blocking)
+{
+    const int TOTAL_NUMBERS = TestConfig::LOW_RATE_MESSAGES_PER_THREAD * producerCount;
+
+    auto container = std::make_unique<RingType>(1024);
+    TEST_ASSERT(container->IsValid(), "RingBuffer 할당 실패");
+
+    std::vector<std::atomic<int>> dequeueCheck(TOTAL_NUMBERS);
+    for (int i = 0; i < TOTAL_NUMBERS; i++)
+        dequeueCheck[i] = 0;
+
+    std::atomic<int> totalDequeued(0);
+    std::vector<double> consumerCpuMs(consumerCount, 0.0);
+    std::vector<std::thread> threads;
+
+    for (int producerId = 0; producerId < producerCount; producerId++)
+    {
+        threads.emplace_back([&, producerId]()
+        {
+            int startNum = producerId * TestConfig::LOW_RATE_MESSAGES_PER_THREAD;
+            for (int i = 0; i < TestConfig::LOW_RATE_MESSAGES_PER_THREAD; i++)
+            {
+                int num = startNum + i;
+                if (blocking)
+                {
+                    size_t written = container->EnqueueWait(&num, sizeof(int));
+                    TEST_ASSERT(written == sizeof(int), "EnqueueWait 실패");
+                }
+                else
+                {
+                    while (container->Enqueue(&num, sizeof(int)) == 0)
+                    {
+                    }
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(TestConfig::LOW_RATE_INTERVAL_US));
+            }
+        });
+    }
+
+    for (int consumerId = 0; consumerId < consumerCount; consumerId++)
+    {
+        threads.emplace_back([&, consumerId]()
+        {
+            double cpuStart = GetThreadCpuTimeMs();
+
+            while (totalDequeued < TOTAL_NUMBERS)
+            {
+                int num = 0;
+                // 종료 확인을 위해 짧은 타임아웃으로 대기
+                size_t read = blocking ? container->DequeueWait(&num, sizeof(int), 10) : container->Dequeue(&num, sizeof(int));
+                if (read == 0)
+                    continue;
+
+                TEST_ASSERT(read == sizeof(int), "DequeueWait 크기 불일치");
+                TEST_ASSERT(num >= 0 && num < TOTAL_NUMBERS, "범위 초과 숫자 발견");
+                int expected = 0;
+                TEST_ASSERT(dequeueCheck[num].compare_exchange_strong(expected, 1), "중복 Dequeue 발견!");
+                ++totalDequeued;
+            }
+
+            consumerCpuMs[consumerId] = GetThreadCpuTimeMs() - cpuStart;
+        });
+    }
+
+    for (auto& t : threads) t.join();
+
+    TEST_ASSERT(totalDequeued == TOTAL_NUMBERS, "Dequeue 개수 불일치");
+    for (int i = 0; i < TOTAL_NUMBERS; i++)
+    {
+        TEST_ASSERT(dequeueCheck[i] == 1, "누락된 숫자 발견");
+    }
+
+    double totalCpuMs = 0.0;
+    for (int i = 0; i < consumerCount; i++)
+        totalCpuMs += consumerCpuMs[i];
+    return totalCpuMs;
+}
+
+void Test_BlockingWait()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Phase 2-4] 블로킹 API (EnqueueWait/DequeueWait) 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // 1. 타임아웃: 비어 있으면 DequeueWait, 가득 차면 EnqueueWait가 제한 시간 후 0 반환
+    {
+        CRingBufferWaitMT ring(64);
+        char buffer[64] = {};
+        size_t usable = ring.GetFreeSize();
+
+        auto start = std::chrono::steady_clock::now();
+        TEST_ASSERT(ring.DequeueWait(buffer, 1, 50) == 0, "빈 버퍼 DequeueWait가 성공함");
+        auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        TEST_ASSERT(waited >= 45, "DequeueWait 타임아웃보다 일찍 반환");
+
+        TEST_ASSERT(ring.Enqueue(buffer, usable) == usable, "버퍼 채우기 실패");
+        start = std::chrono::steady_clock::now();
+        TEST_ASSERT(ring.EnqueueWait(buffer, 1, 50) == 0, "가득 찬 버퍼 EnqueueWait가 성공함");
+        waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        TEST_ASSERT(waited >= 45, "EnqueueWait 타임아웃보다 일찍 반환");
+
+        // 용량보다 큰 요청은 영원히 성공할 수 없으므로 바로 0
+        TEST_ASSERT(ring.DequeueWait(buffer, usable + 1) == 0, "용량 초과 DequeueWait 허용됨");
+        TEST_ASSERT(ring.EnqueueWait(buffer, usable + 1) == 0, "용량 초과 EnqueueWait 허용됨");
+        std::cout << "  [PASS] 타임아웃 / 용량 초과" << std::endl;
+    }
+
+    // 2. 깨우기: 잠든 소비자/생산자가 반대편 동작으로 깨어나는지 (무한 대기)
+    {
+        CRingBufferWaitMT ring(64);
+        size_t usable = ring.GetFreeSize();
+
+        int received = 0;
+        std::thread consumer([&]() {
+            TEST_ASSERT(ring.DequeueWait(&received, sizeof(int)) == sizeof(int), "DequeueWait 실패");
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        int value = 0x12345678;
+        TEST_ASSERT(ring.Enqueue(&value, sizeof(int)) == sizeof(int), "Enqueue 실패");
+        consumer.join();
+        TEST_ASSERT(received == value, "DequeueWait 데이터 불일치");
+
+        std::vector<char> fill(usable, 'A');
+        TEST_ASSERT(ring.Enqueue(fill.data(), usable) == usable, "버퍼 채우기 실패");
+        char extra = 'B';
+        std::thread producer([&]() {
+            TEST_ASSERT(ring.EnqueueWait(&extra, 1) == 1, "EnqueueWait 실패");
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        char drained = 0;
+        TEST_ASSERT(ring.Dequeue(&drained, 1) == 1, "Dequeue 실패");
+        producer.join();
+        TEST_ASSERT(ring.GetDataSize() == usable, "EnqueueWait 후 데이터 크기 불일치");
+        std::cout << "  [PASS] 대기 중 깨우기 (empty -> non-empty, full -> non-full)" << std::endl;
+    }
+
+    // 3. 저빈도 생산자: 재시도 루프 vs 블로킹 대기의 소비자 CPU 사용 시간
+    std::cout << "\n[저빈도 Producer-Consumer] 생산자당 " << TestConfig::LOW_RATE_MESSAGES_PER_THREAD
+        << "개, " << TestConfig::LOW_RATE_INTERVAL_US << "us 간격" << std::endl;
+    std::cout << "  조합 | 재시도 루프 CPU (ms) | 블로킹 대기 CPU (ms)" << std::endl;
+
+    double spinMs = RunLowRateTest<CRingBufferWaitSPSC>(1, 1, false);
+    double waitMs = RunLowRateTest<CRingBufferWaitSPSC>(1, 1, true);
+    std::cout << "  SPSC 1-1 | " << spinMs << " | " << waitMs << std::endl;
+
+    spinMs = RunLowRateTest<CRingBufferWaitMT>(1, 1, false);
+    waitMs = RunLowRateTest<CRingBufferWaitMT>(1, 1, true);
+    std::cout << "  MT 1-1 | " << spinMs << " | " << waitMs << std::endl;
+
+    spinMs = RunLowRateTest<CRingBufferWaitMT>(2, 2, false);
+    waitMs = RunLowRateTest<CRingBufferWaitMT>(2, 2, true);
+    std::cout << "  MT 2-2 | " << spinMs << " | " << waitMs << std::endl;
+
+    std::cout << "\n[PASS] 블로킹 API 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    g_testCount++;
+}
+
+//=============================================================================
+// Phase 2-5: 성장 모드 (EnableGrowth) 검증
+// 단일 스레드: wrap 상태에서의 재배치, 상한, 축소, 랜덤 버스트 무결성
+// 멀티스레드: 생산자/소비자가 동작하는 중에 성장/축소가 반복되어도 유실/중복이 없는지
+//=============================================================================
+
+// 생산량이 소비량보다 많은 구간과 적은 구간을 번갈아 실행하며 순서 번호 무결성 확인
+// 반환값: 용량이 바뀐 횟수
+template<typename RingType>
+uint64_t RunGrowableSingleThreadTest(const char* ringName)
+{
+    const size_t INITIAL_CAPACITY = 64;
+    const size_t MAX_CAPACITY = 64 * 1024;
+
+    RingType ring(INITIAL_CAPACITY);
+    TEST_ASSERT(ring.IsValid(), "RingBuffer 할당 실패");
+    size_t initialCapacity = ring.GetCapacity();
+    TEST_ASSERT(ring.EnableGrowth(MAX_CAPACITY, true), "EnableGrowth 실패");
+
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<> sizeDis(1, 512);
+    std::vector<unsigned char> writeBuffer(512);
+    std::vector<unsigned char> readBuffer(512);
+
+    unsigned char writeSeq = 0;
+    unsigned char readSeq = 0;
+    size_t lastCapacity = ring.GetCapacity();
+    size_t maxSeen = lastCapacity;
+    uint64_t capacityChanges = 0;
+    const uint64_t ITERATIONS = TestConfig::GROWABLE_ITERATIONS;
+
+    for (uint64_t i = 0; i < ITERATIONS; i++)
+    {
+        g_totalIterations++;
+
+        // 65536회마다 생산 우세 / 소비 우세 구간 전환
+        bool producerHeavy = ((i >> 16) & 1) == 0;
+        bool doEnqueue = producerHeavy ? (gen() % 4 != 0) : (gen() % 4 == 0);
+        int size = sizeDis(gen);
+
+        if (doEnqueue)
+        {
+            for (int j = 0; j < size; j++)
+                writeBuffer[j] = static_cast<unsigned char>(writeSeq + j);
+
+            if (ring.Enqueue(writeBuffer.data(), size) == (size_t)size)
+                writeSeq = static_cast<unsigned char>(writeSeq + size);
+            else
+                TEST_ASSERT(ring.GetDataSize() + size >= MAX_CAPACITY, "성장 가능한데 Enqueue 실패");
+        }
+        else
+        {
+            size_t read = ring.DequeueBatch(readBuffer.data(), size);
+            for (size_t j = 0; j < read; j++)
+            {
+                TEST_ASSERT(readBuffer[j] == static_cast<unsigned char>(readSeq + j), "재배치 후 데이터 순서 불일치");
+            }
+            readSeq = static_cast<unsigned char>(readSeq + read);
+        }
+
+        size_t capacity = ring.GetCapacity();
+        TEST_ASSERT(capacity >= initialCapacity && capacity <= MAX_CAPACITY, "용량이 범위를 벗어남");
+        if (capacity != lastCapacity)
+        {
+            capacityChanges++;
+            lastCapacity = capacity;
+            maxSeen = (std::max)(maxSeen, capacity);
+        }
+
+        PrintProgress(ringName, i, ITERATIONS);
+    }
+
+    std::cout << "  [PASS] " << ringName << " 랜덤 버스트 (용량 변경 " << capacityChanges
+        << "회, 최대 " << maxSeen << " 바이트)" << std::endl;
+    return capacityChanges;
+}
+
+// 생산자/소비자 동작 중 성장/축소 - 소비자가 주기적으로 쉬어 버퍼가 커졌다가 다시 줄어듦
+template<typename RingType>
+void RunGrowableConcurrentTest(int producerCount, int consumerCount)
+{
+    const int TOTAL_NUMBERS = (int)TestConfig::GROWABLE_NUMBERS_PER_THREAD * producerCount;
+
+    auto container = std::make_unique<RingType>(64);
+    TEST_ASSERT(container->IsValid(), "RingBuffer 할당 실패");
+    TEST_ASSERT(container->EnableGrowth(1024 * 1024, true), "EnableGrowth 실패");
+
+    std::vector<std::atomic<int>> dequeueCheck(TOTAL_NUMBERS);
+    for (int i = 0; i < TOTAL_NUMBERS; i++)
+        dequeueCheck[i] = 0;
+
+    std::atomic<int> totalDequeued(0);
+    std::atomic<bool> done(false);
+    // 용량 변화 관찰
+    size_t lastCapacity = container->GetCapacity();
+    size_t maxCapacity = lastCapacity;
+    uint64_t capacityChanges = 0;
+    std::thread observer([&]() {
+        while (!done)
+        {
+            size_t capacity = container->GetCapacity();
+            if (capacity != lastCapacity)
+            {
+                capacityChanges++;
+                lastCapacity = capacity;
+                maxCapacity = (std::max)(maxCapacity, capacity);
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    });
+
+    std::vector<std::thread> threads;
+    std::random_device rd;
+
+    for (int producerId = 0; producerId < producerCount; producerId++)
+    {
+        threads.emplace_back([&, producerId]()
+        {
+            std::mt19937 gen(rd() + producerId);
+            std::uniform_int_distribution<> sizeDis(1, 32);
+            int batch[32];
+
+            int currentNum = producerId * (int)TestConfig::GROWABLE_NUMBERS_PER_THREAD;
+            int endNum = currentNum + (int)TestConfig::GROWABLE_NUMBERS_PER_THREAD;
+
+            while (currentNum < endNum)
+            {
+                int batchSize = (std::min)(sizeDis(gen), endNum - currentNum);
+                for (int i = 0; i < batchSize; i++)
+                    batch[i] = currentNum + i;
+
+                while (container->Enqueue(batch, batchSize * sizeof(int)) == 0)
+                {
+                }
+                currentNum += batchSize;
+            }
+        });
+    }
+
+    for (int consumerId = 0; consumerId < consumerCount; consumerId++)
+    {
+        threads.emplace_back([&, consumerId]()
+        {
+            std::mt19937 gen(rd() + 1000 + consumerId);
+            std::uniform_int_distribution<> sizeDis(1, 32);
+            std::vector<int> readBuffer(32);
+            std::vector<int> lastSeen(producerCount, -1);
+            uint64_t reads = 0;
+
+            while (totalDequeued < TOTAL_NUMBERS)
+            {
+                // 주기적으로 쉬어서 생산자가 버퍼를 키우게 함
+                if (++reads % 8192 == 0)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+                size_t read = container->Dequeue(readBuffer.data(), sizeDis(gen) * sizeof(int));
+                if (read == 0)
+                    continue;
+
+                size_t numCount = read / sizeof(int);
+                for (size_t i = 0; i < numCount; i++)
+                {
+                    int num = readBuffer[i];
+                    TEST_ASSERT(num >= 0 && num < TOTAL_NUMBERS, "범위 초과 숫자 발견");
+                    int expected = 0;
+                    TEST_ASSERT(dequeueCheck[num].compare_exchange_strong(expected, 1), "중복 Dequeue 발견!");
+
+                    // 소비자가 하나면 생산자별 순서가 재배치 후에도 유지되어야 함
+                    if (consumerCount == 1)
+                    {
+                        int producerId = num / (int)TestConfig::GROWABLE_NUMBERS_PER_THREAD;
+                        TEST_ASSERT(num > lastSeen[producerId], "재배치 후 생산자별 순서 깨짐");
+                        lastSeen[producerId] = num;
+                    }
+                }
+                totalDequeued += (int)numCount;
+            }
+        });
+    }
+
+    for (auto& t : threads) t.join();
+    done = true;
+    observer.join();
+
+    TEST_ASSERT(totalDequeued == TOTAL_NUMBERS, "Dequeue 개수 불일치");
+    TEST_ASSERT(container->GetDataSize() == 0, "잔여 데이터 존재");
+    for (int i = 0; i < TOTAL_NUMBERS; i++)
+    {
+        TEST_ASSERT(dequeueCheck[i] == 1, "누락된 숫자 발견");
+    }
+
+    std::cout << "  [PASS] Producer " << producerCount << " / Consumer " << consumerCount
+        << " (관찰된 용량 변경 " << capacityChanges << "회, 최대 " << maxCapacity << " 바이트, 종료 시 "
+        << container->GetCapacity() << " 바이트)" << std::endl;
+    g_testCount++;
+}
+
+void Test_Growable()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Phase 2-5] 성장 모드 (EnableGrowth) 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // 1. wrap 된 상태에서 성장 - 재배치 후 순서 유지
+    {
+        CRingBufferST ring(64);
+        TEST_ASSERT(ring.EnableGrowth(64 * 1024, true), "EnableGrowth 실패");
+        TEST_ASSERT(!ring.EnableGrowth(32), "현재 용량보다 작은 상한 허용됨");
+
+        CRingBufferSPSC spsc(64);
+        TEST_ASSERT(!spsc.EnableGrowth(64 * 1024), "SPSC에서 성장 모드 허용됨");
+
+        unsigned char data[256];
+        for (int i = 0; i < 256; i++)
+            data[i] = static_cast<unsigned char>(i);
+
+        TEST_ASSERT(ring.Enqueue(data, 40) == 40, "Enqueue 실패");
+        unsigned char out[256];
+        TEST_ASSERT(ring.Dequeue(out, 30) == 30, "Dequeue 실패");
+        TEST_ASSERT(ring.Enqueue(data + 40, 50) == 50, "wrap Enqueue 실패");   // 끝에서 wrap
+        TEST_ASSERT(ring.GetCapacity() == 64, "성장이 필요 없는데 용량 변경");
+
+        TEST_ASSERT(ring.Enqueue(data + 90, 100) == 100, "성장 Enqueue 실패");  // 60 + 100 -> 256
+        TEST_ASSERT(ring.GetCapacity() == 256, "GROWTH_FACTOR배 성장 아님");
+        TEST_ASSERT(ring.Dequeue(out, 160) == 160, "Dequeue 실패");
+        TEST_ASSERT(std::memcmp(out, data + 30, 160) == 0, "재배치 후 데이터 불일치");
+
+        // 상한을 넘는 요청은 All-or-Nothing으로 실패하고 용량은 유지
+        std::vector<char> huge(64 * 1024, 'X');
+        TEST_ASSERT(ring.Enqueue(huge.data(), huge.size()) == 0, "상한 초과 Enqueue 허용됨");
+        TEST_ASSERT(ring.GetCapacity() == 256, "실패한 Enqueue가 용량을 바꿈");
+        TEST_ASSERT(ring.Enqueue(huge.data(), huge.size() - 1) == huge.size() - 1, "상한까지 성장 실패");
+        TEST_ASSERT(ring.GetCapacity() == 64 * 1024, "상한까지 성장하지 않음");
+        TEST_ASSERT(ring.Dequeue(huge.data(), huge.size() - 1) == huge.size() - 1, "Dequeue 실패");
+
+        // 사용량이 낮은 상태가 이어지면 생성 시 용량까지 절반씩 축소
+        for (uint32_t i = 0; i < CRingBufferST::SHRINK_AFTER_IDLE_OPS * 16; i++)
+        {
+            TEST_ASSERT(ring.Enqueue(data, 8) == 8, "Enqueue 실패");
+            TEST_ASSERT(ring.Dequeue(out, 8) == 8, "Dequeue 실패");
+            TEST_ASSERT(std::memcmp(out, data, 8) == 0, "축소 후 데이터 불일치");
+        }
+        TEST_ASSERT(ring.GetCapacity() == 64, "생성 시 용량으로 축소되지 않음");
+        std::cout << "  [PASS] wrap 상태 성장 / 상한 / 축소" << std::endl;
+    }
+
+    // 2. 랜덤 버스트 (인덱스/저장소 정책별)
+    RunGrowableSingleThreadTest<CRingBufferST>("CRingBufferST");
+    RunGrowableSingleThreadTest<CRingBufferPow2ST>("CRingBufferPow2ST");
+    RunGrowableSingleThreadTest<CRingBufferMirrorST>("CRingBufferMirrorST");
+
+    // 3. 멀티스레드 중 성장/축소
+    RunGrowableConcurrentTest<CRingBufferMT>(1, 1);
+    RunGrowableConcurrentTest<CRingBufferMT>(4, 1);
+    RunGrowableConcurrentTest<CRingBufferMT>(4, 4);
+    RunGrowableConcurrentTest<CRingBufferPow2MT>(2, 2);
+
+    std::cout << "\n[PASS] 성장 모드 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    g_testCount++;
+}
+
+//=============================================================================
+// Phase 2-6: 공유 메모리 프로세스 간 링 (CSharedMemoryRingT) 검증
+// fork로 만든 자식 프로세스가 이름으로 세그먼트에 다시 연결(부모와 다른 주소)해 소비자 역할,
+// 부모가 생산자 역할을 하며 스트림 위치로 만든 바이트 패턴을 끝까지 검증
+//=============================================================================
+
+// 스트림 위치 i의 바이트 - 256바이트 단위 밀림도 잡도록 상위 비트를 섞음
+inline unsigned char SharedStreamByte(uint64_t i)
+{
+    return static_cast<unsigned char>(i ^ (i >> 8) ^ (i >> 16));
+}
+
+#ifdef __linux__
+// 반환값: 처리량 (MB/s)
+template<typename LockPolicy>
+double RunSharedMemoryRingTest(const char* ringName)
+{
+    using SharedRing = CSharedMemoryRingT<LockPolicy>;
+
+    std::string name = "/q_lab_ring_" + std::to_string(getpid());
+    SharedRing shared;
+    TEST_ASSERT(shared.Create(name.c_str(), 1 << 20), "공유 메모리 세그먼트 생성 실패");
+
+    // 같은 이름으로 두 번 만들 수 없음
+    SharedRing duplicate;
+    TEST_ASSERT(!duplicate.Create(name.c_str(), 1 << 20), "같은 이름의 세그먼트 중복 생성 허용됨");
+
+    const uint64_t TOTAL_BYTES = TestConfig::SHARED_MEMORY_BYTES;
+    auto startTime = std::chrono::steady_clock::now();
+
+    pid_t pid = fork();
+    TEST_ASSERT(pid >= 0, "fork 실패");
+
+    if (pid == 0)
+    {
+        // 자식: 상속받은 매핑이 아닌 새 매핑으로 연결 -> 링 객체 주소가 부모와 달라짐
+        SharedRing peer;
+        if (!peer.Open(name.c_str()))
+            _exit(2);
+        if (peer.Get() == shared.Get())
+            _exit(3);
+
+        typename SharedRing::RingType* ring = peer.Get();
+        std::mt19937 gen(4321);
+        std::uniform_int_distribution<> sizeDis(1, 4096);
+        std::vector<unsigned char> readBuffer(4096);
+        uint64_t received = 0;
+
+        while (received < TOTAL_BYTES)
+        {
+            size_t want = (std::min)((uint64_t)sizeDis(gen), TOTAL_BYTES - received);
+            size_t read = ring->DequeueBatch(readBuffer.data(), want);
+            for (size_t i = 0; i < read; i++)
+            {
+                if (readBuffer[i] != SharedStreamByte(received + i))
+                    _exit(1);
+            }
+            received += read;
+        }
+
+        _exit(0);
+    }
+
+    // 부모: 생산자
+    typename SharedRing::RingType* ring = shared.Get();
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<> sizeDis(1, 4096);
+    std::vector<unsigned char> writeBuffer(4096);
+    uint64_t sent = 0;
+
+    while (sent < TOTAL_BYTES)
+    {
+        size_t size = (std::min)((uint64_t)sizeDis(gen), TOTAL_BYTES - sent);
+        for (size_t i = 0; i < size; i++)
+            writeBuffer[i] = SharedStreamByte(sent + i);
+
+        while (ring->Enqueue(writeBuffer.data(), size) == 0)
+        {
+        }
+        sent += size;
+    }
+
+    int status = 0;
+    TEST_ASSERT(waitpid(pid, &status, 0) == pid, "waitpid 실패");
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    TEST_ASSERT(WIFEXITED(status), "소비자 프로세스 비정상 종료");
+    TEST_ASSERT(WEXITSTATUS(status) != 2, "소비자 프로세스 세그먼트 연결 실패");
+    TEST_ASSERT(WEXITSTATUS(status) != 3, "소비자 프로세스 매핑 주소가 같음 (위치 독립성 미검증)");
+    TEST_ASSERT(WEXITSTATUS(status) == 0, "프로세스 간 데이터 불일치");
+    TEST_ASSERT(ring->GetDataSize() == 0, "잔여 데이터 존재");
+
+    double throughputMB = elapsed > 0 ? (double)TOTAL_BYTES / (1024.0 * 1024.0) / (elapsed / 1000.0) : 0.0;
+    std::cout << "  [PASS] " << ringName << " 2-프로세스 " << TOTAL_BYTES << " 바이트 (" << elapsed << " ms, "
+        << throughputMB << " MB/s)" << std::endl;
+
+    shared.Close();
+    SharedRing reopened;
+    TEST_ASSERT(!reopened.Open(name.c_str()), "Close 후에도 이름이 남아 있음");
+
+    g_testCount++;
+    return throughputMB;
+}
+
+// 블로킹 API 프로세스 간 깨우기 - 다른 프로세스에서 잠든 DequeueWait/EnqueueWait를 Enqueue/Dequeue가 깨워야 함
+// 깨우기가 전달되지 않으면 타임아웃까지 잠들었다가 재확인으로 성공하므로, 성공 여부가 아니라 대기 시간으로 판정
+// Phase 1: 자식이 빈 링에서 DequeueWait -> 부모 Enqueue
+// Phase 2: 부모가 가득 찬 링에서 EnqueueWait -> 자식 Dequeue
+// Phase 3: 작은 링으로 EnqueueWait/DequeueWait 스트리밍 (양쪽이 번갈아 잠듦), 바이트 패턴 검증
+void RunSharedMemoryBlockingTest()
+{
+    using SharedRing = CSharedMemoryRingWaitSPSC;
+
+    const size_t CAPACITY = 4096;
+    const size_t CHUNK = 64;
+    const uint32_t WAKE_TIMEOUT_MS = 3000;
+    const int64_t WAKE_LIMIT_MS = 1000;
+    const int SLEEP_MS = 100;
+    const uint64_t TOTAL_BYTES = TestConfig::SHARED_MEMORY_BYTES / 10;
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start)
+    {
+        return (int64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::string name = "/q_lab_wait_" + std::to_string(getpid());
+    SharedRing shared;
+    TEST_ASSERT(shared.Create(name.c_str(), CAPACITY), "공유 메모리 세그먼트 생성 실패");
+
+    pid_t pid = fork();
+    TEST_ASSERT(pid >= 0, "fork 실패");
+
+    if (pid == 0)
+    {
+        SharedRing peer;
+        if (!peer.Open(name.c_str()))
+            _exit(2);
+        SharedRing::RingType* ring = peer.Get();
+
+        // Phase 1: 빈 링에서 잠듦
+        uint64_t value = 0;
+        auto start = std::chrono::steady_clock::now();
+        if (ring->DequeueWait(&value, sizeof(value), WAKE_TIMEOUT_MS) != sizeof(value) || value != 0x1234)
+            _exit(4);
+        if (elapsedMs(start) > WAKE_LIMIT_MS)
+            _exit(5);
+
+        // Phase 2: 부모가 가득 찬 링에서 잠들 시간을 준 뒤 CHUNK만큼 비워 깨움, 이후 남은 것을 모두 꺼냄
+        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
+        unsigned char chunk[CHUNK];
+        for (size_t i = 0; i < CAPACITY / CHUNK + 1; i++)
+        {
+            if (ring->DequeueWait(chunk, CHUNK, WAKE_TIMEOUT_MS) != CHUNK)
+                _exit(6);
+        }
+
+        // Phase 3: 부모와 같은 시드로 크기를 골라 DequeueWait
+        std::mt19937 gen(4321);
+        std::uniform_int_distribution<> sizeDis(1, 1024);
+        std::vector<unsigned char> readBuffer(1024);
+        uint64_t received = 0;
+        while (received < TOTAL_BYTES)
+        {
+            size_t size = (std::min)((uint64_t)sizeDis(gen), TOTAL_BYTES - received);
+            if (ring->DequeueWait(readBuffer.data(), size, WAKE_TIMEOUT_MS) != size)
+                _exit(7);
+            for (size_t i = 0; i < size; i++)
+            {
+                if (readBuffer[i] != SharedStreamByte(received + i))
+                    _exit(1);
+            }
+            received += size;
+        }
+
+        _exit(0);
+    }
+
+    SharedRing::RingType* ring = shared.Get();
+
+    // Phase 1: 자식이 잠든 뒤 Enqueue
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
+    uint64_t value = 0x1234;
+    TEST_ASSERT(ring->Enqueue(&value, sizeof(value)) == sizeof(value), "Enqueue 실패");
+    while (ring->GetDataSize() != 0)
+        std::this_thread::yield();
+
+    // Phase 2: 링을 가득 채우고 EnqueueWait로 잠듦
+    unsigned char chunk[CHUNK] = {};
+    for (size_t i = 0; i < CAPACITY / CHUNK; i++)
+        TEST_ASSERT(ring->Enqueue(chunk, CHUNK) == CHUNK, "링 채우기 실패");
+    TEST_ASSERT(ring->GetFreeSize() == 0, "링이 가득 차지 않음");
+
+    auto start = std::chrono::steady_clock::now();
+    TEST_ASSERT(ring->EnqueueWait(chunk, CHUNK, WAKE_TIMEOUT_MS) == CHUNK, "가득 찬 링의 EnqueueWait 실패");
+    int64_t spaceWakeMs = elapsedMs(start);
+    TEST_ASSERT(spaceWakeMs < WAKE_LIMIT_MS, "다른 프로세스의 Dequeue가 EnqueueWait를 깨우지 못함 (타임아웃까지 잠듦)");
+
+    // Phase 3: 스트리밍
+    std::mt19937 gen(4321);
+    std::uniform_int_distribution<> sizeDis(1, 1024);
+    std::vector<unsigned char> writeBuffer(1024);
+    uint64_t sent = 0;
+    start = std::chrono::steady_clock::now();
+    while (sent < TOTAL_BYTES)
+    {
+        size_t size = (std::min)((uint64_t)sizeDis(gen), TOTAL_BYTES - sent);
+        for (size_t i = 0; i < size; i++)
+            writeBuffer[i] = SharedStreamByte(sent + i);
+        TEST_ASSERT(ring->EnqueueWait(writeBuffer.data(), size, WAKE_TIMEOUT_MS) == size, "스트리밍 EnqueueWait 타임아웃");
+        sent += size;
+    }
+
+    int status = 0;
+    TEST_ASSERT(waitpid(pid, &status, 0) == pid, "waitpid 실패");
+    int64_t elapsed = elapsedMs(start);
+
+    TEST_ASSERT(WIFEXITED(status), "소비자 프로세스 비정상 종료");
+    TEST_ASSERT(WEXITSTATUS(status) != 2, "소비자 프로세스 세그먼트 연결 실패");
+    TEST_ASSERT(WEXITSTATUS(status) != 4, "빈 링의 DequeueWait 실패");
+    TEST_ASSERT(WEXITSTATUS(status) != 5, "다른 프로세스의 Enqueue가 DequeueWait를 깨우지 못함 (타임아웃까지 잠듦)");
+    TEST_ASSERT(WEXITSTATUS(status) != 6, "가득 찬 링 비우기 실패");
+    TEST_ASSERT(WEXITSTATUS(status) != 7, "스트리밍 DequeueWait 타임아웃");
+    TEST_ASSERT(WEXITSTATUS(status) == 0, "프로세스 간 데이터 불일치");
+    TEST_ASSERT(ring->GetDataSize() == 0, "잔여 데이터 존재");
+
+    double throughputMB = elapsed > 0 ? (double)TOTAL_BYTES / (1024.0 * 1024.0) / (elapsed / 1000.0) : 0.0;
+    std::cout << "  [PASS] CSharedMemoryRingWaitSPSC 프로세스 간 깨우기 (EnqueueWait " << spaceWakeMs << " ms, 한도 "
+        << WAKE_LIMIT_MS << " ms), " << CAPACITY << "B 링으로 " << TOTAL_BYTES << " 바이트 (" << elapsed << " ms, "
+        << throughputMB << " MB/s)" << std::endl;
+
+    g_testCount++;
+}
+#endif
+
+void Test_SharedMemoryRing()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Phase 2-6] 공유 메모리 프로세스 간 링 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+#ifdef __linux__
+    // 없는 이름 / 잘못된 용량
+    CSharedMemoryRingSPSC missing;
+    TEST_ASSERT(!missing.Open("/q_lab_ring_missing"), "없는 세그먼트 Open 허용됨");
+    TEST_ASSERT(!missing.Create("/q_lab_ring_invalid", 1000), "2의 제곱이 아닌 용량 허용됨");
+
+    double spscMB = RunSharedMemoryRingTest<SpscLock>("CSharedMemoryRingSPSC");
+    double spinMB = RunSharedMemoryRingTest<SpinLock>("CSharedMemoryRingMT");
+    RunSharedMemoryBlockingTest();
+
+    std::cout << "\n[처리량 비교 (MB/s)]" << std::endl;
+    std::cout << "  - SpscLock (lock-free) : " << spscMB << std::endl;
+    std::cout << "  - SpinLock             : " << spinMB << std::endl;
+    std::cout << "\n[PASS] 공유 메모리 테스트 완료!" << std::endl;
+#else
+    std::cout << "  - fork 기반 테스트는 Linux에서만 실행 (건너뜀)" << std::endl;
+#endif
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// Phase 2-7: 영속 저널 링 (CJournalRingT) 검증
+// 자식 프로세스가 Sync한 레코드와 Sync하지 않은 레코드를 쓰고 _exit (크래시 흉내) ->
+// 부모가 다시 열어 Sync한 레코드만 정확히 복구되는지, 읽기 커서도 Sync 기준으로 복구되는지 확인
+// 이후 Producer-Consumer(1:1) 부하로 buffered fwrite / fwrite + fsync와 처리량 비교
+//=============================================================================
+
+// 레코드 seq = [uint32_t seq][seq로 만든 패턴 바이트 (0 ~ 63)]
+inline size_t MakeJournalRecord(uint32_t seq, unsigned char* record)
+{
+    size_t length = sizeof(uint32_t) + seq % 64;
+    std::memcpy(record, &seq, sizeof(seq));
+    for (size_t i = sizeof(uint32_t); i < length; i++)
+        record[i] = static_cast<unsigned char>(seq * 31 + i);
+    return length;
+}
+
+inline bool CheckJournalRecord(uint32_t expectedSeq, const unsigned char* record, size_t length)
+{
+    unsigned char expected[128];
+    return length == MakeJournalRecord(expectedSeq, expected) && std::memcmp(record, expected, length) == 0;
+}
+
+// 열린 저널에서 count개를 읽으며 firstSeq부터 순서대로인지 확인
+void ReadJournalRecords(CJournalRing& journal, uint32_t firstSeq, uint32_t count)
+{
+    unsigned char record[128];
+    for (uint32_t i = 0; i < count; i++)
+    {
+        size_t length = journal.Read(record, sizeof(record));
+        TEST_ASSERT(length > 0, "저널 레코드 부족");
+        TEST_ASSERT(CheckJournalRecord(firstSeq + i, record, length), "저널 레코드 내용/순서 불일치");
+    }
+}
+
+#ifdef __linux__
+void RunJournalRecoveryTest(const std::string& path)
+{
+    const uint32_t SYNCED = 500;
+    const uint32_t UNSYNCED = 300;
+    const size_t NEVER = SIZE_MAX;
+
+    std::remove(path.c_str());
+
+    // 1. 자식: SYNCED개 Sync 후 UNSYNCED개를 더 쓰고 Close 없이 종료
+    pid_t pid = fork();
+    TEST_ASSERT(pid >= 0, "fork 실패");
+    if (pid == 0)
+    {
+        CJournalRing journal;
+        if (!journal.Open(path.c_str(), 1 << 16, NEVER, UINT32_MAX))
+            _exit(2);
+
+        unsigned char record[128];
+        for (uint32_t seq = 0; seq < SYNCED + UNSYNCED; seq++)
+        {
+            if (journal.Append(record, MakeJournalRecord(seq, record)) == 0)
+                _exit(1);
+            if (seq == SYNCED - 1 && !journal.Sync())
+                _exit(1);
+        }
+        _exit(0);
+    }
+
+    int status = 0;
+    TEST_ASSERT(waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0, "저널 생산자 프로세스 실패");
+
+    // 2. 재시작: Sync한 SYNCED개만 있어야 함 (용량은 파일에 기록된 값 사용)
+    {
+        CJournalRing journal;
+        TEST_ASSERT(journal.Open(path.c_str(), 0, NEVER, UINT32_MAX), "저널 재오픈 실패");
+        TEST_ASSERT(journal.Get()->GetCapacity() == (1 << 16), "저널 용량 복구 실패");
+        TEST_ASSERT(journal.GetRecoveredSize() > 0, "복구된 데이터 없음");
+        ReadJournalRecords(journal, 0, SYNCED);
+
+        unsigned char record[128];
+        TEST_ASSERT(journal.Read(record, sizeof(record)) == 0, "Sync하지 않은 레코드가 복구됨");
+    }
+    std::cout << "  [PASS] 크래시 후 Sync한 " << SYNCED << "개만 복구 (미 Sync " << UNSYNCED << "개 제외)" << std::endl;
+
+    // 3. 위의 Close가 읽기 커서를 Sync했으므로 이제 비어 있어야 함 -> 새로 쓰고 읽기 쪽 크래시 확인
+    pid = fork();
+    TEST_ASSERT(pid >= 0, "fork 실패");
+    if (pid == 0)
+    {
+        CJournalRing journal;
+        if (!journal.Open(path.c_str(), 0, NEVER, UINT32_MAX) || journal.GetRecoveredSize() != 0)
+            _exit(2);
+
+        unsigned char record[128];
+        for (uint32_t seq = 0; seq < SYNCED; seq++)
+        {
+            if (journal.Append(record, MakeJournalRecord(seq, record)) == 0)
+                _exit(1);
+        }
+        if (!journal.Sync())
+            _exit(1);
+
+        // 절반을 읽고 Sync 없이 종료 -> 다시 읽혀야 함 (at-least-once)
+        for (uint32_t seq = 0; seq < SYNCED / 2; seq++)
+        {
+            if (journal.Read(record, sizeof(record)) == 0)
+                _exit(1);
+        }
+        _exit(0);
+    }
+
+    TEST_ASSERT(waitpid(pid, &status, 0) == pid && WIFEXITED(status), "저널 소비자 프로세스 비정상 종료");
+    TEST_ASSERT(WEXITSTATUS(status) != 2, "저널이 비어 있지 않음 (읽기 커서 복구 실패)");
+    TEST_ASSERT(WEXITSTATUS(status) == 0, "저널 소비자 프로세스 실패");
+
+    {
+        CJournalRing journal;
+        TEST_ASSERT(journal.Open(path.c_str(), 0, NEVER, UINT32_MAX), "저널 재오픈 실패");
+        ReadJournalRecords(journal, 0, SYNCED / 2);
+        TEST_ASSERT(journal.Sync(), "저널 Sync 실패");
+    }
+    {
+        CJournalRing journal;
+        TEST_ASSERT(journal.Open(path.c_str(), 0, NEVER, UINT32_MAX), "저널 재오픈 실패");
+        ReadJournalRecords(journal, SYNCED / 2, SYNCED - SYNCED / 2);
+
+        unsigned char record[128];
+        TEST_ASSERT(journal.Read(record, sizeof(record)) == 0, "Sync로 소비한 레코드가 다시 복구됨");
+    }
+    std::cout << "  [PASS] Sync 전 소비분은 재전달, Sync 후 소비분은 제거" << std::endl;
+
+    std::remove(path.c_str());
+    g_testCount++;
+}
+#endif
+
+// 한 스레드에서 가득 찰 때까지 쓰고 모두 읽기를 반복 - wrap과 "Sync 전 소비 구간 보호" 경로 확인
+void RunJournalWrapTest(const std::string& path)
+{
+    std::remove(path.c_str());
+
+    CJournalRing journal;
+    TEST_ASSERT(journal.Open(path.c_str(), 1 << 12, SIZE_MAX, UINT32_MAX), "저널 생성 실패");
+
+    unsigned char record[128];
+    uint32_t writeSeq = 0;
+    uint32_t readSeq = 0;
+    for (int round = 0; round < 2'000; round++)
+    {
+        while (journal.Append(record, MakeJournalRecord(writeSeq, record)) != 0)
+            writeSeq++;
+
+        TEST_ASSERT(writeSeq > readSeq, "빈 저널에 Append 실패 (Sync 전 소비 구간 보호 오동작)");
+        ReadJournalRecords(journal, readSeq, writeSeq - readSeq);
+        readSeq = writeSeq;
+    }
+
+    journal.Close();
+
+    // 형식이 다른 파일은 열지 않음
+    FILE* file = std::fopen(path.c_str(), "wb");
+    TEST_ASSERT(file != nullptr, "파일 생성 실패");
+    std::fputs("not a journal", file);
+    std::fclose(file);
+    TEST_ASSERT(!journal.Open(path.c_str(), 1 << 12), "형식이 다른 파일 Open 허용됨");
+
+    std::remove(path.c_str());
+    std::cout << "  [PASS] wrap " << writeSeq << "개 레코드 순환 + 잘못된 파일 거부" << std::endl;
+    g_testCount++;
+}
+
+enum class JournalBenchmarkMode
+{
+    Journal,        // CJournalRing (생산자 Append + 소비자 스레드 Read)
+    Buffered,       // fwrite (stdio 버퍼만, 디스크 보장 없음)
+    BufferedSync,   // fwrite + fflush + fsync (저널과 같은 바이트 주기)
+};
+
+// Test_ProducerConsumer 1:1 부하 모양: 숫자 1 ~ 32개 묶음을 한 레코드로 기록
+// 반환값: 처리량 (MB/s)
+double RunJournalBenchmark(const std::string& path, JournalBenchmarkMode mode, size_t syncEveryBytes)
+{
+    const uint64_t TOTAL_NUMBERS = TestConfig::JOURNAL_NUMBERS;
+
+    std::remove(path.c_str());
+
+    CJournalRing journal;
+    FILE* file = nullptr;
+    if (mode == JournalBenchmarkMode::Journal)
+        TEST_ASSERT(journal.Open(path.c_str(), 1 << 22, syncEveryBytes, 10), "저널 생성 실패");
+    else
+        TEST_ASSERT((file = std::fopen(path.c_str(), "wb")) != nullptr, "파일 생성 실패");
+
+    std::atomic<bool> consumerFailed(false);
+    std::thread consumer;
+    if (mode == JournalBenchmarkMode::Journal)
+    {
+        consumer = std::thread([&]()
+        {
+            uint32_t batch[32];
+            uint64_t expected = 0;
+            while (expected < TOTAL_NUMBERS)
+            {
+                size_t length = journal.Read(batch, sizeof(batch));
+                for (size_t i = 0; i < length / sizeof(uint32_t); i++)
+                {
+                    if (batch[i] != static_cast<uint32_t>(expected++))
+                        consumerFailed = true;
+                }
+            }
+        });
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<> batchDis(1, 32);
+    uint32_t batch[32];
+    uint64_t sent = 0;
+    size_t pendingBytes = 0;
+
+    while (sent < TOTAL_NUMBERS)
+    {
+        size_t count = (std::min)((uint64_t)batchDis(gen), TOTAL_NUMBERS - sent);
+        for (size_t i = 0; i < count; i++)
+            batch[i] = static_cast<uint32_t>(sent + i);
+
+        size_t size = count * sizeof(uint32_t);
+        if (mode == JournalBenchmarkMode::Journal)
+        {
+            while (journal.Append(batch, size) == 0)
+            {
+                journal.SyncIfDue();
+            }
+        }
+        else
+        {
+            // 저널과 같은 프레임 형식 ([길이][본문])으로 기록
+            uint32_t header = static_cast<uint32_t>(size);
+            std::fwrite(&header, sizeof(header), 1, file);
+            std::fwrite(batch, size, 1, file);
+
+            pendingBytes += sizeof(header) + size;
+            if (mode == JournalBenchmarkMode::BufferedSync && pendingBytes >= syncEveryBytes)
+            {
+                std::fflush(file);
+#if defined(_WIN32)
+                _commit(_fileno(file));
+#elif defined(__linux__)
+                fsync(fileno(file));
+#endif
+                pendingBytes = 0;
+            }
+        }
+        sent += count;
+    }
+
+    if (mode == JournalBenchmarkMode::Journal)
+    {
+        consumer.join();
+        TEST_ASSERT(!consumerFailed, "저널 Producer-Consumer 데이터 불일치");
+        TEST_ASSERT(journal.Sync(), "저널 Sync 실패");
+        journal.Close();
+    }
+    else
+    {
+        std::fflush(file);
+        if (mode == JournalBenchmarkMode::BufferedSync)
+        {
+#if defined(_WIN32)
+            _commit(_fileno(file));
+#elif defined(__linux__)
+            fsync(fileno(file));
+#endif
+        }
+        std::fclose(file);
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+    std::remove(path.c_str());
+
+    double totalMB = (double)(TOTAL_NUMBERS * sizeof(uint32_t)) / (1024.0 * 1024.0);
+    return elapsed > 0 ? totalMB / (elapsed / 1000.0) : 0.0;
+}
+
+void Test_JournalRing()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Phase 2-7] 영속 저널 링 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::string path = "q_lab_journal_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".jrnl";
+
+#ifdef __linux__
+    RunJournalRecoveryTest(path);
+#else
+    std::cout << "  - fork 기반 크래시 복구 테스트는 Linux에서만 실행 (건너뜀)" << std::endl;
+#endif
+    RunJournalWrapTest(path);
+
+    // Sync 주기별 처리량 (fwrite 버퍼링은 크래시 시 보장이 없으므로 상한선 참고용)
+    const size_t syncSizes[] = { 64 * 1024, 1024 * 1024 };
+    double bufferedMB = RunJournalBenchmark(path, JournalBenchmarkMode::Buffered, 0);
+
+    std::cout << "\n[처리량 비교 (MB/s, Producer-Consumer 1:1, " << TestConfig::JOURNAL_NUMBERS << "개 숫자)]" << std::endl;
+    std::cout << "  - fwrite (버퍼링만, 보장 없음) : " << bufferedMB << std::endl;
+    for (size_t syncSize : syncSizes)
+    {
+        double journalMB = RunJournalBenchmark(path, JournalBenchmarkMode::Journal, syncSize);
+        double syncMB = RunJournalBenchmark(path, JournalBenchmarkMode::BufferedSync, syncSize);
+        std::cout << "  - Sync 주기 " << syncSize / 1024 << " KB" << std::endl;
+        std::cout << "      CJournalRing (msync)       : " << journalMB << std::endl;
+        std::cout << "      fwrite + fflush + fsync    : " << syncMB << std::endl;
+    }
+
+    std::cout << "\n[PASS] 저널 링 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// Phase 1-4: 타입 큐 (CRingQueueT) 검증
+// Phase 1-1(데이터 무결성), 1-2(불변성)를 요소 단위 큐로 이식
+// 이동 전용 추적 타입으로 Push/Pop이 복사 없이 이동만 하는지, 남은 요소가 모두 파괴되는지 확인
+// 이후 SPSC 1:1로 바이트 링(CRingBufferPow2SPSC)과 8바이트 요소 처리량 비교
+//=============================================================================
+
+// 살아 있는 객체 수와 복사 횟수를 세는 요소 타입
+struct RingQueueTracked
+{
+    static std::atomic<int64_t> s_live;
+    static std::atomic<int64_t> s_copies;
+
+    uint64_t value;
+
+    RingQueueTracked() : value(0) { s_live++; }
+    explicit RingQueueTracked(uint64_t v) : value(v) { s_live++; }
+    RingQueueTracked(const RingQueueTracked& other) : value(other.value) { s_live++; s_copies++; }
+    RingQueueTracked(RingQueueTracked&& other) noexcept : value(other.value) { other.value = UINT64_MAX; s_live++; }
+    RingQueueTracked& operator=(const RingQueueTracked& other) { value = other.value; s_copies++; return *this; }
+    RingQueueTracked& operator=(RingQueueTracked&& other) noexcept { value = other.value; other.value = UINT64_MAX; return *this; }
+    ~RingQueueTracked() { s_live--; }
+};
+
+std::atomic<int64_t> RingQueueTracked::s_live(0);
+std::atomic<int64_t> RingQueueTracked::s_copies(0);
+
+inline uint64_t RingQueueValueOf(uint64_t value) { return value; }
+inline uint64_t RingQueueValueOf(const RingQueueTracked& value) { return value.value; }
+
+// Phase 1-1 이식: 무작위 개수(1~10)를 넣고 Pop / TryPopBulk로 무작위 개수를 꺼내며 순서 검증
+template<typename QueueType, typename ElementType>
+void RunRingQueueIntegrity(const char* queueName)
+{
+    const uint64_t ITERATIONS = TestConfig::RING_QUEUE_ITERATIONS;
+    const int64_t liveBefore = RingQueueTracked::s_live;
+    const int64_t copiesBefore = RingQueueTracked::s_copies;
+
+    auto queue = std::make_unique<QueueType>();
+
+    std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<> countDis(1, 10);
+
+    uint64_t writeSequence = 0;
+    uint64_t readSequence = 0;
+    std::vector<ElementType> readBuffer(10);
+
+    for (uint64_t i = 0; i < ITERATIONS; i++)
+    {
+        g_totalIterations = i;
+        PrintProgress(queueName, i, ITERATIONS);
+
+        if (queue->GetFreeSize() >= 10)
+        {
+            int writeCount = countDis(gen);
+            for (int j = 0; j < writeCount; j++)
+            {
+                ElementType value(writeSequence++);
+                TEST_ASSERT(queue->Push(std::move(value)), "Push 실패 (여유 공간 있음)");
+            }
+        }
+
+        int readCount = countDis(gen);
+        size_t read = 0;
+        if (i % 2 == 0)
+        {
+            read = queue->TryPopBulk(readBuffer.data(), readCount);
+        }
+        else
+        {
+            while (read < (size_t)readCount && queue->Pop(readBuffer[read]))
+                read++;
+        }
+
+        TEST_ASSERT(read <= (size_t)readCount, "요청보다 많이 꺼냄");
+        for (size_t j = 0; j < read; j++)
+        {
+            TEST_ASSERT(RingQueueValueOf(readBuffer[j]) == readSequence, "데이터 손상: 시퀀스 번호 불일치");
+            readSequence++;
+        }
+    }
+
+    {
+        ElementType value;
+        while (queue->Pop(value))
+        {
+            TEST_ASSERT(RingQueueValueOf(value) == readSequence, "최종 데이터 검증 실패");
+            readSequence++;
+        }
+    }
+
+    TEST_ASSERT(readSequence == writeSequence, "총 넣은 요소와 꺼낸 요소 개수 불일치");
+    TEST_ASSERT(queue->GetSize() == 0, "큐가 완전히 비워지지 않음");
+    TEST_ASSERT(RingQueueTracked::s_copies == copiesBefore, "Push/Pop/TryPopBulk 중 요소 복사 발생");
+
+    // 남은 요소가 있는 채로 소멸 -> 모두 파괴되어야 함
+    for (int j = 0; j < 100; j++)
+        queue->Emplace(j);
+    queue.reset();
+    readBuffer.clear();
+    TEST_ASSERT(RingQueueTracked::s_live == liveBefore, "요소 파괴 누락 (소멸자)");
+
+    std::cout << "  [PASS] " << queueName << " 데이터 무결성 (" << ITERATIONS << " 회, " << writeSequence << " 개)" << std::endl;
+    g_testCount++;
+}
+
+// Phase 1-2 이식: 무작위 작업 (Push/Pop/Peek/TryPopBulk/Clear) 후 Size + FreeSize == Capacity
+template<typename QueueType, typename ElementType>
+void RunRingQueueInvariants(const char* queueName)
+{
+    const uint64_t ITERATIONS = TestConfig::RING_QUEUE_ITERATIONS;
+    const size_t capacity = QueueType::GetCapacity();
+    const int64_t liveBefore = RingQueueTracked::s_live;
+
+    auto queue = std::make_unique<QueueType>();
+
+    std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<> countDis(1, 64);
+    std::uniform_int_distribution<> opDis(0, 4);
+
+    std::vector<ElementType> buffer(64);
+
+    for (uint64_t i = 0; i < ITERATIONS; i++)
+    {
+        g_totalIterations = i;
+        PrintProgress(queueName, i, ITERATIONS);
+
+        size_t beforeSize = queue->GetSize();
+        TEST_ASSERT(beforeSize + queue->GetFreeSize() == capacity, "불변 조건 위반: Size + FreeSize != Capacity");
+
+        int count = countDis(gen);
+
+        switch (opDis(gen))
+        {
+        case 0: // Push
+        {
+            size_t pushed = 0;
+            while (pushed < (size_t)count && queue->Push(ElementType(i)))
+                pushed++;
+            TEST_ASSERT(pushed == (std::min)((size_t)count, capacity - beforeSize), "Push 개수 불일치");
+            TEST_ASSERT(queue->GetSize() == beforeSize + pushed, "Push 후 Size 증가량 불일치");
+            break;
+        }
+        case 1: // Pop
+        {
+            size_t popped = 0;
+            while (popped < (size_t)count && queue->Pop(buffer[popped]))
+                popped++;
+            TEST_ASSERT(popped == (std::min)((size_t)count, beforeSize), "Pop 개수 불일치");
+            TEST_ASSERT(queue->GetSize() == beforeSize - popped, "Pop 후 Size 감소량 불일치");
+            break;
+        }
+        case 2: // Peek
+        {
+            bool peeked = queue->Peek(buffer[0]);
+            TEST_ASSERT(peeked == (beforeSize > 0), "Peek 결과 불일치");
+            TEST_ASSERT(queue->GetSize() == beforeSize, "Peek 후 Size가 변경됨");
+            break;
+        }
+        case 3: // TryPopBulk
+        {
+            size_t popped = queue->TryPopBulk(buffer.data(), count);
+            TEST_ASSERT(popped == (std::min)((size_t)count, beforeSize), "TryPopBulk 개수 불일치");
+            TEST_ASSERT(queue->GetSize() == beforeSize - popped, "TryPopBulk 후 Size 감소량 불일치");
+            break;
+        }
+        case 4: // Clear
+        {
+            queue->Clear();
+            TEST_ASSERT(queue->GetSize() == 0, "Clear 후 Size가 0이 아님");
+            TEST_ASSERT(queue->GetFreeSize() == capacity, "Clear 후 FreeSize가 Capacity가 아님");
+            break;
+        }
+        }
+
+        TEST_ASSERT(queue->GetSize() + queue->GetFreeSize() == capacity, "작업 후 불변 조건 위반");
+    }
+
+    queue.reset();
+    buffer.clear();
+    TEST_ASSERT(RingQueueTracked::s_live == liveBefore, "요소 파괴 누락 (Clear/소멸자)");
+
+    std::cout << "  [PASS] " << queueName << " 불변성 (" << ITERATIONS << " 회)" << std::endl;
+    g_testCount++;
+}
+
+// SPSC 1:1로 uint64_t를 하나씩 전달 - 반환값: 처리량 (MB/s)
+template<bool UseTypedQueue>
+double RunRingQueueSpscBenchmark()
+{
+    const uint64_t TOTAL = TestConfig::NUMBERS_PER_THREAD;
+
+    auto queue = std::make_unique<CRingQueueT<uint64_t, 8192, SpscLock>>();
+    auto ring = std::make_unique<CRingBufferPow2SPSC>(8192 * sizeof(uint64_t));
+    std::atomic<bool> failed(false);
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::thread consumer([&]()
+    {
+        uint64_t value = 0;
+        for (uint64_t expected = 0; expected < TOTAL; expected++)
+        {
+            if constexpr (UseTypedQueue)
+            {
+                while (!queue->Pop(value))
+                    std::this_thread::yield();
+            }
+            else
+            {
+                while (ring->Dequeue(&value, sizeof(value)) == 0)
+                    std::this_thread::yield();
+            }
+
+            if (value != expected)
+                failed = true;
+        }
+    });
+
+    for (uint64_t i = 0; i < TOTAL; i++)
+    {
+        if constexpr (UseTypedQueue)
+        {
+            while (!queue->Push(i))
+                std::this_thread::yield();
+        }
+        else
+        {
+            while (ring->Enqueue(&i, sizeof(i)) == 0)
+                std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+    TEST_ASSERT(!failed, "SPSC 순서 불일치");
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+    double totalMB = (double)(TOTAL * sizeof(uint64_t)) / (1024.0 * 1024.0);
+    return elapsed > 0 ? totalMB / (elapsed / 1000.0) : 0.0;
+}
+
+void Test_RingQueue()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Phase 1-4] 타입 큐 (CRingQueueT) 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    RunRingQueueIntegrity<CRingQueueT<uint64_t, 1024>, uint64_t>("CRingQueueT<uint64_t, 1024>");
+    RunRingQueueIntegrity<CRingQueueT<RingQueueTracked, 1024>, RingQueueTracked>("CRingQueueT<Tracked, 1024>");
+    RunRingQueueInvariants<CRingQueueT<uint64_t, 256>, uint64_t>("CRingQueueT<uint64_t, 256>");
+    RunRingQueueInvariants<CRingQueueT<RingQueueTracked, 256, MutexLock>, RingQueueTracked>("CRingQueueT<Tracked, 256, MutexLock>");
+
+    double queueMB = RunRingQueueSpscBenchmark<true>();
+    double ringMB = RunRingQueueSpscBenchmark<false>();
+
+    std::cout << "\n[SPSC 1:1 처리량 비교 (8바이트 요소 " << TestConfig::NUMBERS_PER_THREAD << "개)]" << std::endl;
+    std::cout << "  - CRingQueueT<uint64_t, 8192, SpscLock> : " << queueMB << " MB/s" << std::endl;
+    std::cout << "  - CRingBufferPow2SPSC (8바이트 Enqueue)  : " << ringMB << " MB/s" << std::endl;
+
+    std::cout << "\n[PASS] 타입 큐 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// Phase 2-8: 다중 생산자 fan-in (CRingFanIn) 검증
+// N:1 조합에서 생산자별 전용 SPSC 링 (RoundRobin / Occupancy / Sequence 병합)과
+// 하나의 공유 링 (CRingBufferMT 메시지 모드)을 같은 부하로 비교
+// 생산자마다 자기 구간의 숫자를 1~32개 묶음 메시지로 보내고, 소비자는 생산자별 순서/누락/중복을 확인
+//=============================================================================
+
+// sharedRing이면 CRingBufferMT 하나를 모든 생산자가 공유, 아니면 CRingFanIn(order)
+// 반환값: 처리량 (MB/s)
+double RunFanInTest(int producerCount, bool sharedRing, FanInDrainOrder order)
+{
+    const uint64_t NUMBERS_PER_THREAD = TestConfig::FAN_IN_NUMBERS_PER_THREAD;
+    const uint64_t TOTAL_NUMBERS = NUMBERS_PER_THREAD * producerCount;
+
+    auto shared = std::make_unique<CRingBufferMT>(65536);
+    auto fanIn = std::make_unique<CRingFanIn>(65536, producerCount, order);
+    TEST_ASSERT(shared->IsValid() && fanIn->IsValid(), "링 생성 실패");
+
+    // 생산자별 다음에 와야 할 숫자 (생산자 구간 = [id * NUMBERS_PER_THREAD, (id + 1) * NUMBERS_PER_THREAD))
+    std::vector<uint64_t> nextExpected(producerCount);
+    for (int i = 0; i < producerCount; i++)
+        nextExpected[i] = (uint64_t)i * NUMBERS_PER_THREAD;
+
+    uint64_t received = 0;
+    auto onMessage = [&](const void* data, size_t size)
+    {
+        TEST_ASSERT(size % sizeof(uint32_t) == 0 && size > 0 && size <= 32 * sizeof(uint32_t), "fan-in 메시지 크기 손상");
+
+        const uint32_t* numbers = static_cast<const uint32_t*>(data);
+        size_t count = size / sizeof(uint32_t);
+        int producer = (int)(numbers[0] / NUMBERS_PER_THREAD);
+        TEST_ASSERT(producer < producerCount, "범위 초과 숫자 발견");
+
+        for (size_t i = 0; i < count; i++)
+        {
+            TEST_ASSERT(numbers[i] == nextExpected[producer], "생산자별 순서 위반 (누락/중복)");
+            nextExpected[producer]++;
+        }
+        received += count;
+    };
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> producers;
+    for (int threadId = 0; threadId < producerCount; threadId++)
+    {
+        producers.emplace_back([&, threadId]()
+        {
+            std::mt19937 gen(1234 + threadId);
+            std::uniform_int_distribution<> sizeDis(1, 32);
+            uint32_t batch[32];
+
+            uint64_t current = (uint64_t)threadId * NUMBERS_PER_THREAD;
+            uint64_t end = current + NUMBERS_PER_THREAD;
+
+            while (current < end)
+            {
+                size_t count = (std::min)((uint64_t)sizeDis(gen), end - current);
+                for (size_t i = 0; i < count; i++)
+                    batch[i] = static_cast<uint32_t>(current + i);
+
+                size_t size = count * sizeof(uint32_t);
+                size_t written = 0;
+                while (written == 0)
+                {
+                    written = sharedRing ? shared->EnqueueMessage(batch, size) : fanIn->Enqueue(batch, size);
+                    if (written == 0)
+                        std::this_thread::yield();
+                }
+
+                TEST_ASSERT(written == size, "Enqueue 크기 불일치");
+                current += count;
+            }
+        });
+    }
+
+    uint32_t readBuffer[32];
+    while (received < TOTAL_NUMBERS)
+    {
+        if (sharedRing)
+        {
+            size_t read = shared->DequeueMessage(readBuffer, sizeof(readBuffer));
+            if (read > 0)
+            {
+                onMessage(readBuffer, read);
+                continue;
+            }
+        }
+        else if (fanIn->DrainAll(onMessage) > 0)
+        {
+            continue;
+        }
+
+        std::this_thread::yield();
+    }
+
+    for (auto& t : producers) t.join();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    TEST_ASSERT(received == TOTAL_NUMBERS, "수신 개수 불일치");
+    TEST_ASSERT(shared->GetDataSize() == 0 && fanIn->GetDataSize() == 0, "버퍼가 완전히 비워지지 않음");
+    if (!sharedRing)
+        TEST_ASSERT(fanIn->GetProducerCount() == producerCount, "생산자 링 등록 개수 불일치");
+
+    g_testCount++;
+
+    double totalMB = (double)(TOTAL_NUMBERS * sizeof(uint32_t)) / (1024.0 * 1024.0);
+    return elapsed > 0 ? totalMB / (elapsed / 1000.0) : 0.0;
+}
+
+// Sequence 병합 검증: 생산자들이 mutex 안에서 (값 증가 -> Enqueue) 하므로 순번 순서 == 값 순서
+// 소비자는 여러 링에 흩어진 메시지를 0, 1, 2, ... 순서 그대로 받아야 함
+void RunFanInSequenceTest(int producerCount)
+{
+    const uint64_t TOTAL = TestConfig::FAN_IN_NUMBERS_PER_THREAD / 10 * producerCount;
+
+    auto fanIn = std::make_unique<CRingFanIn>(4096, producerCount, FanInDrainOrder::Sequence);
+    std::mutex orderLock;
+    uint64_t nextValue = 0;
+
+    std::vector<std::thread> producers;
+    for (int threadId = 0; threadId < producerCount; threadId++)
+    {
+        producers.emplace_back([&]()
+        {
+            while (true)
+            {
+                orderLock.lock();
+                uint64_t value = nextValue;
+                if (value >= TOTAL)
+                {
+                    orderLock.unlock();
+                    break;
+                }
+
+                // 링이 가득 차면 잠시 놓았다가 다시 시도 (값은 Enqueue 성공 후에만 증가)
+                if (fanIn->Enqueue(&value, sizeof(value)) == 0)
+                {
+                    orderLock.unlock();
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                nextValue++;
+                orderLock.unlock();
+            }
+        });
+    }
+
+    uint64_t expected = 0;
+    while (expected < TOTAL)
+    {
+        size_t drained = fanIn->DrainAll([&](const void* data, size_t size)
+        {
+            uint64_t value = 0;
+            TEST_ASSERT(size == sizeof(value), "Sequence 메시지 크기 손상");
+            std::memcpy(&value, data, sizeof(value));
+            TEST_ASSERT(value == expected, "Sequence 병합 순서 위반");
+            expected++;
+        });
+
+        if (drained == 0)
+            std::this_thread::yield();
+    }
+
+    for (auto& t : producers) t.join();
+
+    TEST_ASSERT(fanIn->GetDataSize() == 0, "버퍼가 완전히 비워지지 않음");
+    std::cout << "  [PASS] Sequence 병합 " << producerCount << ":1 - " << TOTAL << "개 전체 순서 유지" << std::endl;
+    g_testCount++;
+}
+
+void Test_FanIn()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Phase 2-8] 다중 생산자 fan-in (CRingFanIn) 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    RunFanInSequenceTest(2);
+    RunFanInSequenceTest(8);
+
+    std::vector<int> producerCounts = { 1, 2, 4, 8 };
+
+    std::cout << "\n[N:1 처리량 비교 (MB/s, 생산자당 " << TestConfig::FAN_IN_NUMBERS_PER_THREAD << "개 숫자, 1~32개 묶음 메시지)]" << std::endl;
+    std::cout << "  조합 | 공유 링(MT) | RoundRobin | Occupancy | Sequence" << std::endl;
+    for (size_t i = 0; i < producerCounts.size(); i++)
+    {
+        int producerCount = producerCounts[i];
+        double sharedMB = RunFanInTest(producerCount, true, FanInDrainOrder::RoundRobin);
+        double roundRobinMB = RunFanInTest(producerCount, false, FanInDrainOrder::RoundRobin);
+        double occupancyMB = RunFanInTest(producerCount, false, FanInDrainOrder::Occupancy);
+        double sequenceMB = RunFanInTest(producerCount, false, FanInDrainOrder::Sequence);
+
+        std::cout << "  " << producerCount << ":1  | " << (int)sharedMB << " | " << (int)roundRobinMB
+            << " | " << (int)occupancyMB << " | " << (int)sequenceMB << std::endl;
+    }
+
+    std::cout << "\n[PASS] fan-in 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// Phase 2-9: 단일 작성자 브로드캐스트 링 (CBroadcastRing) 검증
+// Block 모드: 모든 독자가 전체 시퀀스를 빠짐없이 순서대로 받는지 (PeekMessageSpan 제로 카피 + ReadMessage)
+//            독자마다 SPSC 링에 복사해 보내는 기존 방식과 처리량 비교
+// Overwrite 모드: 느린 독자가 밀려나도 찢어진 메시지를 받지 않고, 건너뛴 바이트가 빠진 시퀀스와 정확히 일치하는지
+//=============================================================================
+
+// 메시지 = [uint64_t seq][seq로 만든 패턴 바이트 (0 ~ 55)]
+inline size_t MakeBroadcastMessage(uint64_t seq, unsigned char* message, bool fixedSize)
+{
+    size_t length = sizeof(uint64_t) + (fixedSize ? 56 : seq % 56);
+    std::memcpy(message, &seq, sizeof(seq));
+    for (size_t i = sizeof(uint64_t); i < length; i++)
+        message[i] = static_cast<unsigned char>(seq * 13 + i);
+    return length;
+}
+
+inline bool CheckBroadcastMessage(const unsigned char* message, size_t length, uint64_t& seq, bool fixedSize)
+{
+    unsigned char expected[64];
+    std::memcpy(&seq, message, sizeof(seq));
+    return length == MakeBroadcastMessage(seq, expected, fixedSize) && std::memcmp(message, expected, length) == 0;
+}
+
+// Block 모드 - 반환값: 처리량 (MB/s, 작성자가 보낸 바이트 기준)
+// copyRings면 CBroadcastRing 대신 독자마다 CRingBufferPow2SPSC를 두고 작성자가 N번 복사 (기존 방식)
+double RunBroadcastBlockTest(int readerCount, bool copyRings)
+{
+    const uint64_t TOTAL = TestConfig::BROADCAST_MESSAGES;
+
+    auto ring = std::make_unique<CBroadcastRing>(65536, readerCount, BroadcastOverflow::Block);
+    std::vector<std::unique_ptr<CRingBufferPow2SPSC>> copies;
+    for (int i = 0; i < readerCount; i++)
+        copies.push_back(std::make_unique<CRingBufferPow2SPSC>(65536));
+    TEST_ASSERT(ring->IsValid(), "브로드캐스트 링 생성 실패");
+
+    std::atomic<uint64_t> sentBytes(0);
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> readers;
+    for (int readerId = 0; readerId < readerCount; readerId++)
+    {
+        readers.emplace_back([&, readerId]()
+        {
+            unsigned char message[64];
+            uint64_t expected = 0;
+
+            while (expected < TOTAL)
+            {
+                size_t length = 0;
+                if (copyRings)
+                {
+                    length = copies[readerId]->DequeueMessage(message, sizeof(message));
+                }
+                else if (expected % 2 == 0)
+                {
+                    // 제로 카피: 링 내부를 직접 보고 검증한 뒤 넘김
+                    RingSpans spans = ring->PeekMessageSpan(readerId);
+                    if (spans.count > 0)
+                    {
+                        CopyFromSpans(spans, message, spans.totalSize);
+                        length = ring->ConsumeMessage(readerId);
+                        TEST_ASSERT(length == spans.totalSize, "ConsumeMessage 크기가 PeekMessageSpan과 다름");
+                    }
+                }
+                else
+                {
+                    length = ring->ReadMessage(readerId, message, sizeof(message));
+                }
+
+                if (length == 0)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                uint64_t seq = 0;
+                TEST_ASSERT(CheckBroadcastMessage(message, length, seq, false), "브로드캐스트 메시지 손상");
+                TEST_ASSERT(seq == expected, "브로드캐스트 순서 위반 (누락/중복)");
+                expected++;
+            }
+        });
+    }
+
+    unsigned char message[64];
+    for (uint64_t seq = 0; seq < TOTAL; seq++)
+    {
+        size_t length = MakeBroadcastMessage(seq, message, false);
+        if (copyRings)
+        {
+            for (int i = 0; i < readerCount; i++)
+            {
+                while (copies[i]->EnqueueMessage(message, length) == 0)
+                    std::this_thread::yield();
+            }
+        }
+        else
+        {
+            while (ring->Publish(message, length) == 0)
+                std::this_thread::yield();
+        }
+        sentBytes += length;
+    }
+
+    for (auto& t : readers) t.join();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    for (int i = 0; i < readerCount; i++)
+    {
+        TEST_ASSERT(ring->GetDataSize(i) == 0 && copies[i]->GetDataSize() == 0, "독자가 모두 읽지 않음");
+        TEST_ASSERT(ring->GetLapCount(i) == 0, "Block 모드에서 독자가 밀려남");
+    }
+
+    g_testCount++;
+    double totalMB = (double)sentBytes / (1024.0 * 1024.0);
+    return elapsed > 0 ? totalMB / (elapsed / 1000.0) : 0.0;
+}
+
+// Overwrite 모드: 독자 하나는 매번 쉬어 가며 읽어 계속 밀려남
+void RunBroadcastOverwriteTest(int readerCount)
+{
+    const uint64_t TOTAL = TestConfig::BROADCAST_MESSAGES;
+    const size_t MESSAGE_SIZE = CBroadcastRing::MESSAGE_HEADER_SIZE + sizeof(uint64_t) + 56;
+
+    auto ring = std::make_unique<CBroadcastRing>(4096, readerCount, BroadcastOverflow::Overwrite);
+    TEST_ASSERT(ring->IsValid(), "브로드캐스트 링 생성 실패");
+
+    std::atomic<bool> writerDone(false);
+    std::vector<uint64_t> receivedCounts(readerCount, 0);
+    std::vector<uint64_t> missingCounts(readerCount, 0);
+
+    std::vector<std::thread> readers;
+    for (int readerId = 0; readerId < readerCount; readerId++)
+    {
+        readers.emplace_back([&, readerId]()
+        {
+            unsigned char message[64];
+            uint64_t expected = 0;
+            uint64_t received = 0;
+            bool slowReader = (readerId == 0);
+
+            while (true)
+            {
+                size_t length = ring->ReadMessage(readerId, message, sizeof(message));
+                if (length == 0)
+                {
+                    if (writerDone && ring->GetDataSize(readerId) == 0)
+                        break;
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                uint64_t seq = 0;
+                TEST_ASSERT(CheckBroadcastMessage(message, length, seq, true), "Overwrite 모드에서 찢어진 메시지 수신");
+                TEST_ASSERT(seq >= expected, "Overwrite 모드 순서 역전");
+
+                missingCounts[readerId] += seq - expected;
+                expected = seq + 1;
+                received++;
+
+                if (slowReader && received % 64 == 0)
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+
+            missingCounts[readerId] += TOTAL - expected;
+            receivedCounts[readerId] = received;
+        });
+    }
+
+    unsigned char message[64];
+    for (uint64_t seq = 0; seq < TOTAL; seq++)
+    {
+        size_t length = MakeBroadcastMessage(seq, message, true);
+        TEST_ASSERT(ring->Publish(message, length) == length, "Overwrite 모드 Publish 실패");
+    }
+    writerDone = true;
+
+    for (auto& t : readers) t.join();
+
+    for (int i = 0; i < readerCount; i++)
+    {
+        TEST_ASSERT(receivedCounts[i] + missingCounts[i] == TOTAL, "받은 개수 + 빠진 개수 != 전체");
+        TEST_ASSERT(ring->GetSkippedBytes(i) == missingCounts[i] * MESSAGE_SIZE, "건너뛴 바이트가 빠진 시퀀스와 불일치");
+        TEST_ASSERT((ring->GetLapCount(i) == 0) == (missingCounts[i] == 0), "lap 횟수와 빠진 시퀀스 불일치");
+    }
+    TEST_ASSERT(ring->GetLapCount(0) > 0, "느린 독자가 밀려나지 않음 (Overwrite 경로 미검증)");
+
+    std::cout << "  [PASS] Overwrite 1:" << readerCount << " - 느린 독자 수신 " << receivedCounts[0] << "개, lap "
+        << ring->GetLapCount(0) << "회 (찢어진 메시지 없음, 건너뛴 바이트 일치)" << std::endl;
+    g_testCount++;
+}
+
+void Test_BroadcastRing()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Phase 2-9] 브로드캐스트 링 (CBroadcastRing) 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::vector<int> readerCounts = { 1, 2, 4, 8 };
+
+    std::cout << "\n[Block 모드: 모든 독자 전체 시퀀스 검증 + 처리량 (MB/s, " << TestConfig::BROADCAST_MESSAGES << "개 메시지)]" << std::endl;
+    std::cout << "  조합 | CBroadcastRing | 독자별 SPSC 링 복사" << std::endl;
+    for (size_t i = 0; i < readerCounts.size(); i++)
+    {
+        double broadcastMB = RunBroadcastBlockTest(readerCounts[i], false);
+        double copyMB = RunBroadcastBlockTest(readerCounts[i], true);
+        std::cout << "  1:" << readerCounts[i] << "  | " << (int)broadcastMB << " | " << (int)copyMB << std::endl;
+    }
+
+    std::cout << "\n[Overwrite 모드]" << std::endl;
+    RunBroadcastOverwriteTest(2);
+    RunBroadcastOverwriteTest(4);
+
+    std::cout << "\n[PASS] 브로드캐스트 링 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 대용량 기록 스트리밍 (StreamingCopy) 크기별 비교
+// SPSC 1:1로 같은 바이트 수를 메시지 크기만 바꿔 가며 전송 (8 B ~ 256 KB)
+// PlainCopy(memcpy)와 StreamingCopy<0>(항상 비시간적 저장)의 처리량을 비교해 교차점을 찾음
+// 소비자는 메시지마다 앞/뒤 8바이트에 기록된 순번을 확인 (sfence 누락 시 커서가 데이터보다 먼저 보임)
+//=============================================================================
+
+template<typename RingType>
+double RunStreamingSweep(size_t messageSize)
+{
+    const uint64_t TOTAL_BYTES = TestConfig::STREAMING_SWEEP_BYTES;
+    const uint64_t MESSAGES = TOTAL_BYTES / messageSize;
+
+    auto ring = std::make_unique<RingType>(4 * 1024 * 1024);
+    TEST_ASSERT(ring->IsValid(), "링 생성 실패");
+
+    std::vector<char> source(messageSize);
+    std::atomic<bool> failed(false);
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::thread consumer([&]()
+    {
+        std::vector<char> target(messageSize);
+        uint64_t head = 0;
+        uint64_t tail = 0;
+        for (uint64_t seq = 0; seq < MESSAGES; seq++)
+        {
+            while (ring->Dequeue(target.data(), messageSize) == 0)
+                std::this_thread::yield();
+
+            std::memcpy(&head, target.data(), sizeof(head));
+            std::memcpy(&tail, target.data() + messageSize - sizeof(tail), sizeof(tail));
+            if (head != seq || tail != seq)
+                failed = true;
+        }
+    });
+
+    for (uint64_t seq = 0; seq < MESSAGES; seq++)
+    {
+        std::memcpy(source.data(), &seq, sizeof(seq));
+        std::memcpy(source.data() + messageSize - sizeof(seq), &seq, sizeof(seq));
+        while (ring->Enqueue(source.data(), messageSize) == 0)
+            std::this_thread::yield();
+    }
+
+    consumer.join();
+    TEST_ASSERT(!failed, "스트리밍 복사 데이터 불일치");
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+    double totalMB = (double)(MESSAGES * messageSize) / (1024.0 * 1024.0);
+    return elapsed > 0 ? totalMB / (elapsed / 1000.0) : 0.0;
+}
+
+void Test_StreamingCopy()
+{
+    using PlainRing = CRingBufferT<SpscLock, PowerOfTwoIndex, HeapStorage, PlainCopy>;
+    using StreamRing = CRingBufferT<SpscLock, PowerOfTwoIndex, HeapStorage, StreamingCopy<0>>;
+
+    const char* levelNames[] = { "None (memcpy)", "SSE2", "AVX2" };
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Stream] 대용량 기록 스트리밍 복사 비교" << std::endl;
+    std::cout << "  - CPUID 판별: " << levelNames[(int)GetRingBufferStreamLevel()] << std::endl;
+    std::cout << "  - 현재 기본 임계값: " << RINGBUFFER_STREAMING_THRESHOLD / 1024 << " KB" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const size_t sizes[] = { 8, 64, 512, 4 * 1024, 16 * 1024, 64 * 1024, 256 * 1024 };
+    size_t crossover = 0;
+
+    std::cout << "  메시지 크기 | memcpy (MB/s) | 스트리밍 (MB/s) | 배율" << std::endl;
+    for (size_t size : sizes)
+    {
+        double plainMB = RunStreamingSweep<PlainRing>(size);
+        double streamMB = RunStreamingSweep<StreamRing>(size);
+        double ratio = plainMB > 0.0 ? streamMB / plainMB : 0.0;
+
+        if (crossover == 0 && ratio >= 1.0)
+            crossover = size;
+
+        std::cout << "  " << size << " B | " << (int)plainMB << " | " << (int)streamMB << " | " << ratio << std::endl;
+        g_testCount++;
+    }
+
+    if (crossover != 0)
+        std::cout << "\n  > 교차점: " << crossover << " B 이상에서 스트리밍이 memcpy 이상" << std::endl;
+    else
+        std::cout << "\n  > 교차점 없음: 측정 범위 전체에서 memcpy가 빠름 (임계값을 높이거나 PlainCopy 사용)" << std::endl;
+
+    std::cout << "\n[PASS] 스트리밍 복사 비교 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 고정 크기 Push/Pop 테스트 및 일반 경로(Enqueue/Dequeue) 비교
+// Phase 1: wrap 지점을 걸치는 값 무결성 (용량이 sizeof(T)의 배수가 아닌 링), 바이트 API와 혼용
+// Phase 2: 단일 스레드 처리량 - 1/4/8/16바이트 값을 Enqueue/Dequeue와 Push/Pop으로 같은 횟수만큼 전송
+// Phase 3: 고빈도 경합 (Phase 2-2와 같은 1바이트 항목, MutexLock 4스레드) 일반 경로 vs Push/Pop
+//=============================================================================
+
+struct FixedSizeRecord
+{
+    uint64_t sequence;
+    uint32_t checksum;
+    uint32_t tag;
+};
+
+template<typename T>
+T MakeFixedSizeValue(uint64_t seq)
+{
+    T value;
+    std::memset(&value, 0, sizeof(T));
+    std::memcpy(&value, &seq, (std::min)(sizeof(T), sizeof(seq)));
+    return value;
+}
+
+template<>
+FixedSizeRecord MakeFixedSizeValue<FixedSizeRecord>(uint64_t seq)
+{
+    return FixedSizeRecord{ seq, static_cast<uint32_t>(seq * 2654435761u), static_cast<uint32_t>(~seq) };
+}
+
+// 32개씩 넣고 빼기를 반복해 wrap이 계속 일어나게 함, 반환값은 Mops/s
+// 커서 계산(나머지 연산) 비용이 복사 비용을 가리지 않도록 2의 제곱 인덱스 링 사용
+template<typename T, bool UsePush>
+double RunFixedSizeSweep(uint64_t totalOps)
+{
+    const int BATCH = 32;
+
+    CRingBufferPow2ST ring(1024);
+    TEST_ASSERT(ring.IsValid(), "링 생성 실패");
+
+    uint64_t checksum = 0;
+    uint64_t expected = 0;
+    T value{};
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    for (uint64_t done = 0; done < totalOps; done += BATCH)
+    {
+        for (int i = 0; i < BATCH; i++)
+        {
+            T in = MakeFixedSizeValue<T>(done + i);
+            if constexpr (UsePush)
+                TEST_ASSERT(ring.Push(in), "Push 실패");
+            else
+                TEST_ASSERT(ring.Enqueue(&in, sizeof(T)) == sizeof(T), "Enqueue 실패");
+        }
+
+        for (int i = 0; i < BATCH; i++)
+        {
+            if constexpr (UsePush)
+                TEST_ASSERT(ring.Pop(value), "Pop 실패");
+            else
+                TEST_ASSERT(ring.Dequeue(&value, sizeof(T)) == sizeof(T), "Dequeue 실패");
+
+            uint64_t seq = 0;
+            std::memcpy(&seq, &value, (std::min)(sizeof(T), sizeof(seq)));
+            checksum += seq;
+        }
+
+        for (int i = 0; i < BATCH; i++)
+        {
+            T in = MakeFixedSizeValue<T>(done + i);
+            uint64_t seq = 0;
+            std::memcpy(&seq, &in, (std::min)(sizeof(T), sizeof(seq)));
+            expected += seq;
+        }
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    TEST_ASSERT(checksum == expected, "고정 크기 전송 체크섬 불일치");
+    TEST_ASSERT(ring.GetDataSize() == 0, "전송 후 잔여 데이터 존재");
+
+    return elapsed > 0 ? (double)totalOps / elapsed : 0.0;
+}
+
+// Phase 2-2와 같은 모양: 짝수 스레드는 1바이트 기록, 홀수 스레드는 1바이트 읽기, 반환값은 ops/sec
+template<bool UsePush>
+uint64_t RunFixedSizeContention(int threadCount, uint64_t opsPerThread)
+{
+    CRingBufferMT ring(1024);
+    TEST_ASSERT(ring.IsValid(), "링 생성 실패");
+
+    std::atomic<uint64_t> enqueueCount(0);
+    std::atomic<uint64_t> dequeueCount(0);
+    std::vector<std::thread> threads;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&, i]()
+        {
+            char byte = static_cast<char>(i);
+            char readByte;
+            uint64_t mySuccess = 0;
+
+            for (uint64_t j = 0; j < opsPerThread; j++)
+            {
+                bool ok;
+                if (i % 2 == 0)
+                {
+                    if constexpr (UsePush)
+                        ok = ring.Push(byte);
+                    else
+                        ok = ring.Enqueue(&byte, 1) == 1;
+                }
+                else
+                {
+                    if constexpr (UsePush)
+                        ok = ring.Pop(readByte);
+                    else
+                        ok = ring.Dequeue(&readByte, 1) == 1;
+                }
+
+                if (ok)
+                    mySuccess++;
+            }
+
+            if (i % 2 == 0)
+                enqueueCount += mySuccess;
+            else
+                dequeueCount += mySuccess;
+        });
+    }
+
+    for (auto& t : threads) t.join();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    uint64_t remainCount = 0;
+    char drainByte;
+    while (ring.Pop(drainByte))
+        remainCount++;
+
+    TEST_ASSERT(enqueueCount == dequeueCount + remainCount, "Enqueue 성공 수와 Dequeue 성공 수 + 잔여 수 불일치");
+
+    uint64_t totalSuccess = enqueueCount + dequeueCount;
+    return elapsed > 0 ? totalSuccess * 1000 / elapsed : 0;
+}
+
+void Test_FixedSizePushPop()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Fixed] 고정 크기 Push/Pop 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // Phase 1: wrap 무결성 - 용량 1000은 16바이트의 배수가 아니므로 값이 wrap 지점을 걸침
+    {
+        CRingBufferST ring(1000);
+        TEST_ASSERT(ring.IsValid(), "링 생성 실패");
+
+        const uint64_t ITERATIONS = TestConfig::FIXED_SIZE_ITERATIONS;
+        uint64_t straddleCount = 0;
+
+        for (uint64_t seq = 0; seq < ITERATIONS; seq++)
+        {
+            FixedSizeRecord in = MakeFixedSizeValue<FixedSizeRecord>(seq);
+            size_t offset = ring.GetWriteCursor() % ring.GetCapacity();
+            if (ring.GetCapacity() - offset < sizeof(FixedSizeRecord))
+                straddleCount++;
+
+            TEST_ASSERT(ring.Push(in), "Push 실패");
+
+            FixedSizeRecord peeked = {};
+            TEST_ASSERT(ring.Peek(peeked), "Peek 실패");
+            TEST_ASSERT(peeked.sequence == seq, "Peek 값 불일치");
+
+            // 짝수 번째는 Pop, 홀수 번째는 바이트 API로 읽어 두 경로의 바이트 배치가 같은지 확인
+            FixedSizeRecord out = {};
+            if (seq % 2 == 0)
+                TEST_ASSERT(ring.Pop(out), "Pop 실패");
+            else
+                TEST_ASSERT(ring.Dequeue(&out, sizeof(out)) == sizeof(out), "Dequeue 실패");
+
+            TEST_ASSERT(out.sequence == in.sequence && out.checksum == in.checksum && out.tag == in.tag, "값 불일치");
+            TEST_ASSERT(ring.GetDataSize() == 0, "잔여 데이터 존재");
+
+            PrintProgress("고정 크기 wrap 무결성", seq + 1, ITERATIONS);
+        }
+
+        TEST_ASSERT(straddleCount > 0, "wrap을 걸치는 경우가 한 번도 없음");
+
+        // 공간/데이터 부족 시 All-or-Nothing
+        uint64_t value = 0;
+        TEST_ASSERT(!ring.Pop(value), "빈 링에서 Pop 성공");
+        char filler[995] = {};
+        TEST_ASSERT(ring.Enqueue(filler, sizeof(filler)) == sizeof(filler), "채우기 실패");
+        TEST_ASSERT(!ring.Push(value), "공간 부족인데 Push 성공");
+        TEST_ASSERT(ring.GetDataSize() == sizeof(filler), "실패한 Push가 데이터를 씀");
+
+        std::cout << "\n[PASS] Phase 1: wrap 무결성 (" << ITERATIONS << "회, wrap 걸침 " << straddleCount << "회)" << std::endl;
+        g_testCount++;
+    }
+
+    // Phase 2: 단일 스레드 처리량
+    {
+        const uint64_t OPS = TestConfig::FIXED_SIZE_ITERATIONS;
+        std::cout << "\n[Phase 2] 단일 스레드 처리량 (Mops/s, " << OPS << "회)" << std::endl;
+        std::cout << "  크기 | Enqueue/Dequeue | Push/Pop | 배율" << std::endl;
+
+        auto report = [](const char* name, double generic, double fixed)
+        {
+            std::cout << "  " << name << " | " << generic << " | " << fixed << " | " << (generic > 0.0 ? fixed / generic : 0.0) << std::endl;
+        };
+
+        report("1 B", RunFixedSizeSweep<char, false>(OPS), RunFixedSizeSweep<char, true>(OPS));
+        report("4 B", RunFixedSizeSweep<uint32_t, false>(OPS), RunFixedSizeSweep<uint32_t, true>(OPS));
+        report("8 B", RunFixedSizeSweep<uint64_t, false>(OPS), RunFixedSizeSweep<uint64_t, true>(OPS));
+        report("16 B", RunFixedSizeSweep<FixedSizeRecord, false>(OPS), RunFixedSizeSweep<FixedSizeRecord, true>(OPS));
+
+        std::cout << "[PASS] Phase 2: 단일 스레드 비교 완료" << std::endl;
+        g_testCount++;
+    }
+
+    // Phase 3: 고빈도 경합 (1바이트)
+    {
+        const int THREADS = 4;
+        const uint64_t OPS = TestConfig::FIXED_SIZE_CONTENTION_OPS_PER_THREAD;
+        std::cout << "\n[Phase 3] 고빈도 경합 1바이트 (MutexLock, " << THREADS << "스레드, 스레드당 " << OPS << "회)" << std::endl;
+
+        uint64_t generic = RunFixedSizeContention<false>(THREADS, OPS);
+        uint64_t fixed = RunFixedSizeContention<true>(THREADS, OPS);
+
+        std::cout << "  Enqueue/Dequeue: " << generic << " ops/sec" << std::endl;
+        std::cout << "  Push/Pop       : " << fixed << " ops/sec" << std::endl;
+        std::cout << "  배율           : " << (generic > 0 ? (double)fixed / generic : 0.0) << std::endl;
+
+        std::cout << "[PASS] Phase 3: 고빈도 경합 비교 완료" << std::endl;
+        g_testCount++;
+    }
+
+    std::cout << "\n[PASS] 고정 크기 Push/Pop 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 청크 스트림 (CChunkedStreamT) 테스트
+// Phase 1: Phase 1-1 데이터 무결성 재실행 (256B 청크 - 청크 경계를 자주 넘도록)
+// Phase 2: Phase 2-3 Peek+Consume 재실행 (PeekSpans가 청크 2개에 걸치는 경우 포함)
+// Phase 3: PeekIoVec - 여러 청크에 걸친 데이터를 한 번의 writev 형태로 모아 Peek 복사본과 대조
+// Phase 4: 느린 클라이언트 / 유휴 세션 메모리 - 고정 링(64KB)과 비교
+//=============================================================================
+
+using CChunkedStreamSmallST = CChunkedStreamT<NoLock, 256>;
+using CChunkedStreamSmallMT = CChunkedStreamT<MutexLock, 256>;
+
+void RunChunkedIoVecTest()
+{
+    CChunkedStreamSmallST stream;
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<> sizeDis(1, 1000);
+
+    const int IOV_MAX_COUNT = 16;
+    RingIoVec vec[IOV_MAX_COUNT];
+    std::vector<char> source;
+    std::vector<char> gathered;
+    std::vector<char> peeked;
+    uint8_t writeSeq = 0;
+    uint8_t readSeq = 0;
+    uint64_t multiChunkCount = 0;
+
+    for (int i = 0; i < 100'000; i++)
+    {
+        source.resize(sizeDis(gen));
+        for (char& c : source)
+            c = static_cast<char>(writeSeq++);
+        TEST_ASSERT(stream.Enqueue(source.data(), source.size()) == source.size(), "Enqueue 실패");
+
+        size_t totalSize = 0;
+        int count = stream.PeekIoVec(vec, IOV_MAX_COUNT, totalSize);
+        TEST_ASSERT(count > 0 && totalSize > 0, "PeekIoVec 결과 없음");
+        if (count > 2)
+            multiChunkCount++;
+
+        // writev가 보낼 순서대로 모아 Peek 복사본과 비교
+        gathered.clear();
+        for (int j = 0; j < count; j++)
+        {
+            const char* base = static_cast<const char*>(vec[j].iov_base);
+            gathered.insert(gathered.end(), base, base + vec[j].iov_len);
+        }
+        TEST_ASSERT(gathered.size() == totalSize, "PeekIoVec 합계 불일치");
+
+        peeked.resize(totalSize);
+        TEST_ASSERT(stream.Peek(peeked.data(), totalSize) == totalSize, "Peek 실패");
+        TEST_ASSERT(std::memcmp(gathered.data(), peeked.data(), totalSize) == 0, "PeekIoVec 데이터가 Peek과 다름");
+
+        // 부분 전송을 흉내: 모은 구간 중 일부만 Consume
+        size_t sent = (std::max)((size_t)1, totalSize * (sizeDis(gen) % 100 + 1) / 100);
+        for (size_t j = 0; j < sent; j++)
+            TEST_ASSERT((uint8_t)gathered[j] == readSeq++, "전송 순서 불일치");
+        TEST_ASSERT(stream.Consume(sent) == sent, "Consume 실패");
+        TEST_ASSERT(stream.GetChunkCount() * CChunkedStreamSmallST::CHUNK_DATA_SIZE >= stream.GetDataSize(), "청크 수가 데이터보다 적음");
+    }
+
+    size_t totalSize = 0;
+    int count = 0;
+    while ((count = stream.PeekIoVec(vec, IOV_MAX_COUNT, totalSize)) > 0)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            const char* base = static_cast<const char*>(vec[j].iov_base);
+            for (size_t k = 0; k < vec[j].iov_len; k++)
+                TEST_ASSERT((uint8_t)base[k] == readSeq++, "잔여 데이터 순서 불일치");
+        }
+        TEST_ASSERT(stream.Consume(totalSize) == totalSize, "잔여 Consume 실패");
+    }
+
+    TEST_ASSERT(stream.GetDataSize() == 0 && stream.GetChunkCount() == 0, "비운 뒤 청크가 남음");
+    std::cout << "[PASS] Phase 3: PeekIoVec 무결성 (3개 이상 청크에 걸친 gather " << multiChunkCount << "회)" << std::endl;
+    g_testCount++;
+}
+
+void RunChunkedSessionMemoryTest()
+{
+    const int SESSIONS = TestConfig::CHUNKED_STREAM_SESSIONS;
+    const size_t RING_CAPACITY = 64 * 1024;
+    const size_t BURST_BYTES = 256 * 1024;   // 느린 클라이언트 한 명에게 밀린 출력
+
+    CChunkedStreamMT::Pool& pool = CChunkedStreamMT::Pool::Default();
+    size_t poolUseBefore = pool.GetUseCount();
+
+    // 느린 클라이언트: 고정 링은 용량을 넘으면 버려야 하지만 청크 스트림은 계속 쌓임
+    {
+        CRingBufferMT ring(RING_CAPACITY);
+        CChunkedStreamMT stream;
+        std::vector<char> packet(1024, 'x');
+
+        size_t ringAccepted = 0;
+        size_t streamAccepted = 0;
+        for (size_t sent = 0; sent < BURST_BYTES; sent += packet.size())
+        {
+            ringAccepted += ring.Enqueue(packet.data(), packet.size());
+            streamAccepted += stream.Enqueue(packet.data(), packet.size());
+        }
+
+        TEST_ASSERT(streamAccepted == BURST_BYTES, "청크 스트림이 밀린 출력을 받지 못함");
+        TEST_ASSERT(ringAccepted < BURST_BYTES, "고정 링이 용량보다 많이 받음");
+
+        std::cout << "  느린 클라이언트 (" << BURST_BYTES / 1024 << " KB 밀림): 고정 링 " << ringAccepted / 1024
+                  << " KB 수용 (나머지 버림), 청크 스트림 " << streamAccepted / 1024 << " KB 수용 (청크 "
+                  << stream.GetChunkCount() << "개)" << std::endl;
+
+        // 상한을 주면 그 이상은 거절
+        CChunkedStreamMT bounded(RING_CAPACITY);
+        size_t boundedAccepted = 0;
+        for (size_t sent = 0; sent < BURST_BYTES; sent += packet.size())
+            boundedAccepted += bounded.Enqueue(packet.data(), packet.size());
+        TEST_ASSERT(boundedAccepted == RING_CAPACITY, "상한 지정 스트림이 상한과 다르게 받음");
+    }
+
+    // 유휴 세션: 한 번 몰아서 보낸 뒤 모두 전송 완료된 상태의 세션당 메모리
+    std::vector<std::unique_ptr<CChunkedStreamMT>> sessions;
+    sessions.reserve(SESSIONS);
+    std::vector<char> burst(16 * 1024, 'y');
+    std::vector<char> sink(burst.size());
+
+    for (int i = 0; i < SESSIONS; i++)
+    {
+        sessions.push_back(std::make_unique<CChunkedStreamMT>());
+        TEST_ASSERT(sessions.back()->Enqueue(burst.data(), burst.size()) == burst.size(), "세션 Enqueue 실패");
+    }
+
+    size_t busyBytes = 0;
+    for (auto& session : sessions)
+        busyBytes += session->GetMemoryUsage();
+
+    for (auto& session : sessions)
+        TEST_ASSERT(session->Dequeue(sink.data(), sink.size()) == sink.size(), "세션 Dequeue 실패");
+
+    size_t idleBytes = 0;
+    for (auto& session : sessions)
+    {
+        TEST_ASSERT(session->GetChunkCount() == 0, "유휴 세션이 청크를 들고 있음");
+        idleBytes += session->GetMemoryUsage();
+    }
+    TEST_ASSERT(pool.GetUseCount() == poolUseBefore, "풀에 반납되지 않은 청크 존재");
+
+    size_t ringSessionBytes = sizeof(CRingBufferMT) + RING_CAPACITY;
+    std::cout << "  세션 " << SESSIONS << "개, 16 KB 전송 중 : 청크 스트림 세션당 " << busyBytes / SESSIONS << " B" << std::endl;
+    std::cout << "  세션 " << SESSIONS << "개, 유휴       : 청크 스트림 세션당 " << idleBytes / SESSIONS << " B"
+              << " / 고정 링(64 KB) 세션당 " << ringSessionBytes << " B" << std::endl;
+    std::cout << "  풀에 남은 재사용 청크: " << pool.GetFreeCount() << " 개 (모든 세션이 공유)" << std::endl;
+
+    std::cout << "[PASS] Phase 4: 느린 클라이언트 / 유휴 세션 메모리" << std::endl;
+    g_testCount++;
+}
+
+void Test_ChunkedStream()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Chunked] 풀 기반 청크 스트림 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    Test_DataIntegrity<CChunkedStreamSmallST>("CChunkedStreamT<NoLock, 256>");
+
+    std::vector<std::pair<int, int>> threadConfigs = { {1, 1}, {4, 4} };
+    for (const auto& config : threadConfigs)
+    {
+        std::string runningLine = "[실행 중] 청크 스트림 Producer " + std::to_string(config.first) + " / Consumer " + std::to_string(config.second);
+        RunPeekConsumeTest<CChunkedStreamSmallMT>(config.first, config.second, TestConfig::PEEK_CONSUME_PER_THREAD, {}, runningLine);
+    }
+
+    RunChunkedIoVecTest();
+    RunChunkedSessionMemoryTest();
+
+    std::cout << "\n[PASS] 청크 스트림 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 지연 시간 추적 (LatencyTrace) 테스트
+// Phase 1: 로그-선형 버킷 경계 (모든 값이 자기 버킷 상한 이하, 상대 오차 1/16 이내)
+// Phase 2: 단일 스레드 - 끝까지 소비된 레코드만 기록, Clear는 버림, 메시지/Push API, FIFO 초과 시 측정 제외
+// Phase 3: SPSC 1:1 실시간 관찰 - 트래픽 중에 감시 스레드가 p50/p99/p99.9/max를 읽음 (여유 / 소비자 지연 두 구간)
+// Phase 4: 추적 비용 - CRingBufferPow2SPSC와 CRingBufferTracedSPSC(전수 / 16개 중 1개 표본) 처리량 비교
+//=============================================================================
+
+void PrintLatencySnapshot(const char* label, const RingLatencySnapshot& snapshot)
+{
+    std::cout << "  " << label << " count=" << snapshot.count
+              << " p50=" << snapshot.p50Ns << "ns p99=" << snapshot.p99Ns
+              << "ns p99.9=" << snapshot.p999Ns << "ns max=" << snapshot.maxNs << "ns" << std::endl;
+}
+
+// slowConsumer면 소비자가 1024개마다 잠깐 쉬어 대기 시간이 쌓임, 반환값은 Mops/s
+// 링 용량 8KB = uint64 1024개 = LatencyTrace<> 스탬프 FIFO 크기 -> 모든 레코드가 측정됨
+template<typename RingType>
+double RunLatencyTraceSpsc(uint64_t messages, bool slowConsumer, bool monitor)
+{
+    auto ring = std::make_unique<RingType>(8 * 1024);
+    TEST_ASSERT(ring->IsValid(), "링 생성 실패");
+
+    std::atomic<bool> done(false);
+    std::atomic<bool> failed(false);
+
+    std::thread monitorThread;
+    if constexpr (RingType::TracePolicyType::IsEnabled)
+    {
+        if (monitor)
+        {
+            monitorThread = std::thread([&]()
+            {
+                // 트래픽을 멈추지 않고 스냅샷을 읽음 - 개수는 줄어들지 않아야 함
+                uint64_t lastCount = 0;
+                while (!done)
+                {
+                    RingLatencySnapshot snapshot = ring->GetLatencyTrace().GetSnapshot();
+                    if (snapshot.count < lastCount || snapshot.p50Ns > snapshot.p99Ns || snapshot.p99Ns > snapshot.p999Ns || snapshot.p999Ns > snapshot.maxNs)
+                        failed = true;
+                    lastCount = snapshot.count;
+                    PrintLatencySnapshot("[실행 중]", snapshot);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                }
+            });
+        }
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::thread consumer([&]()
+    {
+        uint64_t value = 0;
+        for (uint64_t seq = 0; seq < messages; seq++)
+        {
+            while (!ring->Pop(value))
+                std::this_thread::yield();
+
+            if (value != seq)
+                failed = true;
+
+            if (slowConsumer && seq % 1024 == 0)
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    });
+
+    for (uint64_t seq = 0; seq < messages; seq++)
+    {
+        while (!ring->Push(seq))
+            std::this_thread::yield();
+    }
+
+    consumer.join();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    done = true;
+    if (monitorThread.joinable())
+        monitorThread.join();
+
+    TEST_ASSERT(!failed, "지연 시간 추적 SPSC 데이터/스냅샷 이상");
+
+    if constexpr (RingType::TracePolicyType::IsEnabled)
+    {
+        RingLatencySnapshot snapshot = ring->GetLatencyTrace().GetSnapshot();
+        TEST_ASSERT(ring->GetLatencyTrace().GetDroppedStamps() == 0, "스탬프 FIFO가 링 용량을 덮지 못함");
+        TEST_ASSERT(snapshot.count == messages / RingType::TracePolicyType::SAMPLE_EVERY, "기록 수가 표본 수와 다름");
+        PrintLatencySnapshot(slowConsumer ? "[소비자 지연]" : "[여유]     ", snapshot);
+    }
+
+    return elapsed > 0 ? (double)messages / elapsed : 0.0;
+}
+
+void Test_LatencyTrace()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Latency] Enqueue -> Dequeue 지연 시간 추적 테스트" << std::endl;
+    std::cout << "  - 1틱 = " << GetRingBufferNsPerTick() << " ns" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // Phase 1: 버킷 경계
+    {
+        std::mt19937_64 gen(42);
+        for (int i = 0; i < 1'000'000; i++)
+        {
+            uint64_t value = gen() >> (gen() % 64);
+            size_t index = CRingLatencyHistogram::BucketIndex(value);
+            TEST_ASSERT(index < CRingLatencyHistogram::BUCKET_COUNT, "버킷 인덱스 범위 초과");
+
+            uint64_t upper = CRingLatencyHistogram::BucketUpperBound(index);
+            TEST_ASSERT(value <= upper, "값이 버킷 상한보다 큼");
+            TEST_ASSERT(index == 0 || value > CRingLatencyHistogram::BucketUpperBound(index - 1), "값이 이전 버킷에 속함");
+            TEST_ASSERT((double)(upper - value) <= (double)value / CRingLatencyHistogram::SUB_BUCKET_COUNT + 1.0, "버킷 상대 오차 초과");
+        }
+        TEST_ASSERT(CRingLatencyHistogram::BucketIndex(UINT64_MAX) == CRingLatencyHistogram::BUCKET_COUNT - 1, "최대값 버킷 불일치");
+
+        std::cout << "[PASS] Phase 1: 로그-선형 버킷 경계 (" << CRingLatencyHistogram::BUCKET_COUNT << "개 버킷)" << std::endl;
+        g_testCount++;
+    }
+
+    // Phase 2: 단일 스레드 기록 규칙
+    {
+        using TracedST = CRingBufferT<NoLock, ModuloIndex, HeapStorage, PlainCopy, LatencyTrace<8>>;
+        TracedST ring(1024);
+        char buffer[64] = {};
+
+        // 레코드 3개 (10, 20, 30바이트) - 15바이트 소비 시 첫 레코드만 끝남
+        ring.Enqueue(buffer, 10);
+        ring.Enqueue(buffer, 20);
+        ring.Enqueue(buffer, 30);
+        TEST_ASSERT(ring.Dequeue(buffer, 15) == 15, "Dequeue 실패");
+        TEST_ASSERT(ring.GetLatencyTrace().GetSnapshot().count == 1, "부분 소비한 레코드가 기록됨");
+        TEST_ASSERT(ring.Consume(15) == 15, "Consume 실패");
+        TEST_ASSERT(ring.GetLatencyTrace().GetSnapshot().count == 2, "Consume으로 끝난 레코드가 기록되지 않음");
+
+        // Clear로 버린 레코드는 기록하지 않음
+        ring.Clear();
+        TEST_ASSERT(ring.GetLatencyTrace().GetSnapshot().count == 2, "Clear로 버린 레코드가 기록됨");
+
+        // 메시지 API / Push-Pop / EnqueueV / ReserveWrite도 같은 방식
+        ring.EnqueueMessage(buffer, 12);
+        TEST_ASSERT(ring.ConsumeMessage() == 12, "ConsumeMessage 실패");
+        ring.EnqueueMessage(buffer, 5);
+        TEST_ASSERT(ring.DequeueMessage(buffer, sizeof(buffer)) == 5, "DequeueMessage 실패");
+        ring.Push(uint32_t(7));
+        uint32_t value = 0;
+        TEST_ASSERT(ring.Pop(value) && value == 7, "Pop 실패");
+        RingIoVec vec[2] = { { buffer, 3 }, { buffer, 4 } };
+        ring.EnqueueV(vec, 2);
+        RingSpans spans = ring.ReserveWrite(9);
+        TEST_ASSERT(spans.count > 0, "ReserveWrite 실패");
+        ring.CommitWrite(9);
+        TEST_ASSERT(ring.DequeueBatch(buffer, sizeof(buffer)) == 16, "DequeueBatch 실패");
+        TEST_ASSERT(ring.GetLatencyTrace().GetSnapshot().count == 7, "API별 기록 수 불일치");
+
+        // 스탬프 FIFO(8개)를 넘는 레코드는 측정에서 제외되지만 순서는 어긋나지 않음
+        for (int i = 0; i < 20; i++)
+            ring.Push(uint8_t(i));
+        for (int i = 0; i < 20; i++)
+        {
+            uint8_t b = 0;
+            TEST_ASSERT(ring.Pop(b) && b == i, "FIFO 초과 후 순서 불일치");
+        }
+        TEST_ASSERT(ring.GetLatencyTrace().GetDroppedStamps() == 12, "측정 제외 수 불일치");
+        TEST_ASSERT(ring.GetLatencyTrace().GetSnapshot().count == 15, "FIFO 초과 후 기록 수 불일치");
+
+        std::cout << "[PASS] Phase 2: 레코드 단위 기록 규칙 (부분 소비 / Clear / 메시지 / Push / FIFO 초과)" << std::endl;
+        g_testCount++;
+    }
+
+    // Phase 3: 실시간 관찰
+    {
+        const uint64_t MESSAGES = TestConfig::LATENCY_TRACE_MESSAGES;
+        std::cout << "\n[Phase 3] SPSC 1:1 (" << MESSAGES << "개 uint64), 감시 스레드가 200ms마다 스냅샷" << std::endl;
+        RunLatencyTraceSpsc<CRingBufferTracedSPSC>(MESSAGES, false, true);
+        RunLatencyTraceSpsc<CRingBufferTracedSPSC>(MESSAGES, true, true);
+
+        std::cout << "[PASS] Phase 3: 트래픽 중 히스토그램 읽기" << std::endl;
+        g_testCount++;
+    }
+
+    // Phase 4: 추적 비용
+    {
+        const uint64_t MESSAGES = TestConfig::LATENCY_TRACE_MESSAGES;
+        using SampledSPSC = CRingBufferT<SpscLock, PowerOfTwoIndex, HeapStorage, PlainCopy, LatencyTrace<1024, 16>>;
+
+        double plain = RunLatencyTraceSpsc<CRingBufferPow2SPSC>(MESSAGES, false, false);
+        double traced = RunLatencyTraceSpsc<CRingBufferTracedSPSC>(MESSAGES, false, false);
+        double sampled = RunLatencyTraceSpsc<SampledSPSC>(MESSAGES, false, false);
+
+        std::cout << "\n[Phase 4] 추적 비용 (SPSC Push/Pop, Mops/s)" << std::endl;
+        std::cout << "  추적 없음: " << plain << std::endl;
+        std::cout << "  전수 추적: " << traced << " (배율 " << (plain > 0.0 ? traced / plain : 0.0) << ")" << std::endl;
+        std::cout << "  1/16 표본: " << sampled << " (배율 " << (plain > 0.0 ? sampled / plain : 0.0) << ")" << std::endl;
+        std::cout << "  sizeof: CRingBufferPow2SPSC " << sizeof(CRingBufferPow2SPSC) << " B, CRingBufferTracedSPSC " << sizeof(CRingBufferTracedSPSC) << " B" << std::endl;
+
+        std::cout << "[PASS] Phase 4: 추적 비용 비교 완료" << std::endl;
+        g_testCount++;
+    }
+
+    std::cout << "\n[PASS] 지연 시간 추적 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 다중 레인 우선순위 링 (CPriorityRingT) 테스트
+// Phase 1: 단일 스레드 드레인 순서 - Strict는 레인 번호 순, Weighted는 가중치 비율, 빈 마스크/작은 버퍼 규칙
+// Phase 2: 레인당 생산자 2개 x 3레인 -> 소비자 1개, 생산자별 순서와 레인 일치 확인 (Strict / Weighted)
+// Phase 3: 포화 상태 레인별 대기 시간 - 대량 이동 패킷이 레인을 채운 상태에서 제어 패킷 지연을
+//          단일 레인(기존 CRingBufferT 하나와 같은 상황) / Strict / Weighted로 비교
+//=============================================================================
+
+struct PriorityTestMessage
+{
+    uint32_t producerId;
+    uint32_t lane;
+    uint64_t sequence;
+    int64_t sendTimeNs;     // Phase 3: steady_clock 기준 송신 시각
+    char payload[8];
+};
+
+int64_t PriorityTestNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RunPriorityDrainOrderTest()
+{
+    PriorityLaneConfig lanes[3] = { { 4096, 4 }, { 4096, 2 }, { 4096, 1 } };
+    PriorityTestMessage message = {};
+
+    // Strict: 섞어서 넣어도 레인 0 -> 1 -> 2 순서로, 레인 안에서는 넣은 순서로
+    {
+        CPriorityRing ring(lanes, 3, PriorityDrainMode::Strict);
+        TEST_ASSERT(ring.IsValid(), "우선순위 링 생성 실패");
+        TEST_ASSERT(ring.IsEmpty() && ring.DequeueNext(&message, sizeof(message)) == 0, "빈 링에서 DequeueNext 성공");
+
+        for (uint64_t i = 0; i < 30; i++)
+        {
+            message.lane = static_cast<uint32_t>(2 - i % 3);
+            message.sequence = i;
+            TEST_ASSERT(ring.Enqueue(message.lane, &message, sizeof(message)) == sizeof(message), "Enqueue 실패");
+        }
+        TEST_ASSERT(ring.GetNonEmptyMask() == 0b111, "비어 있지 않은 레인 마스크 불일치");
+
+        int expectedLane = 0;
+        uint64_t lastSequence[3] = { 0, 0, 0 };
+        bool first[3] = { true, true, true };
+        for (int i = 0; i < 30; i++)
+        {
+            int lane = -1;
+            TEST_ASSERT(ring.DequeueNext(&message, sizeof(message), &lane) == sizeof(message), "DequeueNext 실패");
+            TEST_ASSERT(lane == (int)message.lane, "꺼낸 레인과 메시지 레인 불일치");
+            TEST_ASSERT(lane >= expectedLane, "Strict 순서 위반 (높은 레인이 남았는데 낮은 레인을 꺼냄)");
+            expectedLane = lane;
+            TEST_ASSERT(first[lane] || message.sequence > lastSequence[lane], "레인 내 순서 위반");
+            first[lane] = false;
+            lastSequence[lane] = message.sequence;
+        }
+        TEST_ASSERT(ring.IsEmpty(), "모두 꺼낸 뒤 마스크가 남음");
+    }
+
+    // Weighted 4:2:1 - 모든 레인이 차 있으면 한 바퀴(7개)마다 0,0,0,0,1,1,2
+    {
+        CPriorityRing ring(lanes, 3, PriorityDrainMode::Weighted);
+        for (int lane = 0; lane < 3; lane++)
+        {
+            for (uint64_t i = 0; i < 40; i++)
+            {
+                message.lane = lane;
+                message.sequence = i;
+                ring.Enqueue(lane, &message, sizeof(message));
+            }
+        }
+
+        const int pattern[7] = { 0, 0, 0, 0, 1, 1, 2 };
+        for (int i = 0; i < 70; i++)
+        {
+            int lane = -1;
+            TEST_ASSERT(ring.DequeueNext(&message, sizeof(message), &lane) == sizeof(message), "DequeueNext 실패");
+            TEST_ASSERT(lane == pattern[i % 7], "Weighted 순서가 가중치 패턴과 다름");
+        }
+
+        // 레인 0이 빈 뒤에는 남은 레인끼리 2:1
+        int counts[3] = { 0, 0, 0 };
+        int lane = -1;
+        while (ring.DequeueNext(&message, sizeof(message), &lane) != 0)
+            counts[lane]++;
+        TEST_ASSERT(counts[0] == 0 && counts[1] == 20 && counts[2] == 30, "남은 레인 개수 불일치");
+        TEST_ASSERT(ring.IsEmpty(), "모두 꺼낸 뒤 마스크가 남음");
+    }
+
+    // 버퍼가 작으면 0 반환, 메시지와 비트는 그대로
+    {
+        CPriorityRing ring(lanes, 3, PriorityDrainMode::Strict);
+        ring.Enqueue(1, &message, sizeof(message));
+        char small[4];
+        TEST_ASSERT(ring.DequeueNext(small, sizeof(small)) == 0, "작은 버퍼로 DequeueNext 성공");
+        TEST_ASSERT(ring.GetNonEmptyMask() == 0b010, "작은 버퍼 실패 후 마스크가 바뀜");
+        TEST_ASSERT(ring.DequeueNext(&message, sizeof(message)) == sizeof(message), "다시 읽기 실패");
+        TEST_ASSERT(ring.Enqueue(3, &message, sizeof(message)) == 0 && ring.Enqueue(-1, &message, sizeof(message)) == 0, "범위 밖 레인 Enqueue 성공");
+    }
+
+    std::cout << "[PASS] Phase 1: 드레인 순서 (Strict / Weighted 4:2:1 / 빈 마스크 / 작은 버퍼)" << std::endl;
+    g_testCount++;
+}
+
+void RunPriorityOrderingTest(PriorityDrainMode mode)
+{
+    const int LANES = 3;
+    const int PRODUCERS_PER_LANE = 2;
+    const int PRODUCERS = LANES * PRODUCERS_PER_LANE;
+    const uint64_t PER_PRODUCER = TestConfig::PRIORITY_MESSAGES_PER_PRODUCER;
+
+    PriorityLaneConfig lanes[LANES] = { { 16384, 1 }, { 16384, 2 }, { 16384, 4 } };
+    CPriorityRing ring(lanes, LANES, mode);
+    TEST_ASSERT(ring.IsValid(), "우선순위 링 생성 실패");
+
+    std::vector<std::thread> producers;
+    for (int id = 0; id < PRODUCERS; id++)
+    {
+        producers.emplace_back([&, id]()
+        {
+            PriorityTestMessage message = {};
+            message.producerId = id;
+            message.lane = id % LANES;
+            for (uint64_t seq = 0; seq < PER_PRODUCER; seq++)
+            {
+                message.sequence = seq;
+                while (ring.Enqueue(message.lane, &message, sizeof(message)) == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<uint64_t> nextSequence(PRODUCERS, 0);
+    uint64_t laneCounts[LANES] = {};
+    uint64_t received = 0;
+    PriorityTestMessage message = {};
+
+    while (received < PER_PRODUCER * PRODUCERS)
+    {
+        int lane = -1;
+        if (ring.DequeueNext(&message, sizeof(message), &lane) == 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        TEST_ASSERT(message.producerId < (uint32_t)PRODUCERS, "잘못된 생산자 id");
+        TEST_ASSERT(lane == (int)message.lane && lane == (int)(message.producerId % LANES), "메시지가 다른 레인에서 나옴");
+        TEST_ASSERT(message.sequence == nextSequence[message.producerId], "생산자별 순서 위반 (누락/중복/역전)");
+        nextSequence[message.producerId]++;
+        laneCounts[lane]++;
+        received++;
+    }
+
+    for (auto& t : producers) t.join();
+
+    TEST_ASSERT(ring.DequeueNext(&message, sizeof(message)) == 0, "모두 받은 뒤 남은 메시지");
+    TEST_ASSERT(ring.IsEmpty(), "모두 받은 뒤 마스크가 남음");
+    for (int lane = 0; lane < LANES; lane++)
+        TEST_ASSERT(laneCounts[lane] == PER_PRODUCER * PRODUCERS_PER_LANE, "레인별 수신 개수 불일치");
+
+    std::cout << "[PASS] Phase 2: " << (mode == PriorityDrainMode::Strict ? "Strict  " : "Weighted")
+              << " - 생산자 " << PRODUCERS << "개 x " << PER_PRODUCER << "개, 레인별/생산자별 순서 일치" << std::endl;
+    g_testCount++;
+}
+
+// laneCount == 1이면 모든 패킷이 한 레인 (기존 단일 링) - 제어 패킷 지연은 메시지에 실은 송신 시각으로 직접 잼
+void RunPrioritySaturationTest(const char* label, int laneCount, PriorityDrainMode mode)
+{
+    const int CONTROL_LANE = 0;
+    const int BULK_LANE = laneCount - 1;
+    const int BULK_PRODUCERS = 2;
+    const int CONTROL_MESSAGES = TestConfig::PRIORITY_CONTROL_MESSAGES;
+
+    // 레인 용량 32KB = 36바이트 메시지 약 900개 -> LatencyTrace<> 스탬프 FIFO(1024) 안에 들어옴
+    PriorityLaneConfig lanes[2] = { { 32768, 1 }, { 32768, 8 } };
+    CPriorityRingTraced ring(lanes, laneCount, mode);
+    TEST_ASSERT(ring.IsValid(), "우선순위 링 생성 실패");
+
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> producers;
+
+    for (int id = 0; id < BULK_PRODUCERS; id++)
+    {
+        producers.emplace_back([&, id]()
+        {
+            PriorityTestMessage message = {};
+            message.producerId = 1 + id;
+            message.lane = BULK_LANE;
+            while (!stop)
+            {
+                message.sendTimeNs = PriorityTestNowNs();
+                if (ring.Enqueue(BULK_LANE, &message, sizeof(message)) == 0)
+                    std::this_thread::yield();
+                message.sequence++;
+            }
+        });
+    }
+
+    producers.emplace_back([&]()
+    {
+        PriorityTestMessage message = {};
+        message.producerId = 0;
+        message.lane = CONTROL_LANE;
+        for (int i = 0; i < CONTROL_MESSAGES; i++)
+        {
+            message.sequence = i;
+            message.sendTimeNs = PriorityTestNowNs();
+            while (ring.Enqueue(CONTROL_LANE, &message, sizeof(message)) == 0)
+                std::this_thread::yield();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    // 소비자: 메시지마다 약 2us의 처리 시간을 흉내 내서 대량 레인이 항상 밀려 있게 함
+    std::vector<int64_t> controlLatencies;
+    controlLatencies.reserve(CONTROL_MESSAGES);
+    uint64_t bulkReceived = 0;
+    PriorityTestMessage message = {};
+
+    while ((int)controlLatencies.size() < CONTROL_MESSAGES)
+    {
+        if (ring.DequeueNext(&message, sizeof(message)) == 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        int64_t now = PriorityTestNowNs();
+        if (message.producerId == 0)
+            controlLatencies.push_back(now - message.sendTimeNs);
+        else
+            bulkReceived++;
+
+        while (PriorityTestNowNs() - now < 2000)
+            RingBufferCpuRelax();
+    }
+
+    stop = true;
+    for (auto& t : producers) t.join();
+
+    std::sort(controlLatencies.begin(), controlLatencies.end());
+    auto percentile = [&](double p) { return controlLatencies[(size_t)(p * (controlLatencies.size() - 1))] / 1000; };
+
+    std::cout << "\n  [" << label << "] 제어 패킷 " << CONTROL_MESSAGES << "개 동안 대량 패킷 " << bulkReceived << "개 처리" << std::endl;
+    std::cout << "    제어 패킷 지연 (us): p50=" << percentile(0.5) << " p99=" << percentile(0.99) << " max=" << controlLatencies.back() / 1000 << std::endl;
+    for (int lane = 0; lane < laneCount; lane++)
+    {
+        RingLatencySnapshot snapshot = ring.GetLaneTrace(lane).GetSnapshot();
+        std::cout << "    레인 " << lane << " 대기 시간 (us): count=" << snapshot.count << " p50=" << snapshot.p50Ns / 1000
+                  << " p99=" << snapshot.p99Ns / 1000 << " p99.9=" << snapshot.p999Ns / 1000 << " max=" << snapshot.maxNs / 1000
+                  << " (측정 제외 " << ring.GetLaneTrace(lane).GetDroppedStamps() << ")" << std::endl;
+    }
+
+    // 범위 밖 레인은 빈 트레이스
+    TEST_ASSERT(ring.GetLaneTrace(-1).GetSnapshot().count == 0, "음수 레인은 빈 트레이스");
+    TEST_ASSERT(ring.GetLaneTrace(laneCount).GetSnapshot().count == 0, "범위 밖 레인은 빈 트레이스");
+
+    g_testCount++;
+}
+
+void Test_PriorityRing()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Priority] 다중 레인 우선순위 링 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    RunPriorityDrainOrderTest();
+
+    RunPriorityOrderingTest(PriorityDrainMode::Strict);
+    RunPriorityOrderingTest(PriorityDrainMode::Weighted);
+
+    std::cout << "\n[Phase 3] 포화 상태 레인별 대기 시간 (대량 생산자 2개, 제어 패킷 1ms 간격)" << std::endl;
+    RunPrioritySaturationTest("단일 레인", 1, PriorityDrainMode::Strict);
+    RunPrioritySaturationTest("Strict 2레인", 2, PriorityDrainMode::Strict);
+    RunPrioritySaturationTest("Weighted 2레인 (1:8)", 2, PriorityDrainMode::Weighted);
+
+    std::cout << "\n[PASS] 다중 레인 우선순위 링 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 체크섬 레코드 (EnqueueRecord/DequeueRecord, CRC32C) 테스트
+// Phase 1: CRC32C 알려진 값, 하드웨어(SSE4.2) == 테이블, 복사 + 누적 결과 일치
+// Phase 2: 레코드 왕복 무결성 (모듈러 wrap / 미러링 저장소)
+// Phase 3: 장애 주입 - 원시 버퍼의 바이트를 뒤집거나 덮어쓰고 DequeueRecord가 감지하는지
+// Phase 4: 처리량 - 메시지 API(체크섬 없음) vs 레코드 API(체크섬), 크기별
+//=============================================================================
+
+template<typename RingType>
+void RunRecordRoundTrip(const char* name, size_t capacity)
+{
+    RingType ring(capacity);
+    TEST_ASSERT(ring.IsValid(), "링 생성 실패");
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> sizeDis(1, 200);
+    std::vector<unsigned char> input(256);
+    std::vector<unsigned char> output(256);
+    uint64_t sequence = 0;
+
+    for (uint64_t i = 0; i < TestConfig::RECORD_ITERATIONS; i++)
+    {
+        size_t size = sizeDis(gen);
+        for (size_t j = 0; j < size; j++)
+            input[j] = static_cast<unsigned char>(sequence + j * 31);
+
+        TEST_ASSERT(ring.EnqueueRecord(input.data(), size) == size, "EnqueueRecord 실패");
+        TEST_ASSERT(ring.DequeueRecord(output.data(), output.size()) == size, "DequeueRecord 크기 불일치");
+        TEST_ASSERT(std::memcmp(input.data(), output.data(), size) == 0, "DequeueRecord 내용 불일치");
+        sequence++;
+    }
+
+    TEST_ASSERT(ring.GetRecordErrorCount() == 0, "손상 없는 왕복에서 오류 감지");
+    TEST_ASSERT(ring.GetDataSize() == 0, "왕복 후 데이터가 남음");
+    std::cout << "[PASS] Phase 2: " << name << " 레코드 왕복 " << TestConfig::RECORD_ITERATIONS << "회 (용량 " << capacity << ")" << std::endl;
+    g_testCount++;
+}
+
+// 레코드 3개를 넣고 그중 하나(target)의 바이트를 손상시킴 -> target 앞은 정상, target에서 감지, 나머지는 버려짐
+// corruptCount: 덮어쓸 바이트 수 (1이면 xor로 뒤집기 = CRC32C가 항상 감지하는 8비트 이하 버스트)
+bool InjectRecordFault(CRingBufferST& ring, std::mt19937& gen, int corruptCount)
+{
+    std::uniform_int_distribution<int> sizeDis(1, 300);
+    size_t sizes[3];
+    size_t recordStart[3];
+    size_t offset = 0;
+    unsigned char input[3][300];
+
+    for (int r = 0; r < 3; r++)
+    {
+        sizes[r] = sizeDis(gen);
+        for (size_t j = 0; j < sizes[r]; j++)
+            input[r][j] = static_cast<unsigned char>(gen());
+        TEST_ASSERT(ring.EnqueueRecord(input[r], sizes[r]) == sizes[r], "EnqueueRecord 실패");
+        recordStart[r] = offset;
+        offset += CRingBufferST::RECORD_HEADER_SIZE + sizes[r];
+    }
+
+    // 원시 버퍼를 직접 건드림 (PeekSpans: 읽을 수 있는 구간 전체를 가리킴)
+    RingSpans spans = ring.PeekSpans();
+    TEST_ASSERT(spans.totalSize == offset, "PeekSpans 크기 불일치");
+
+    int target = gen() % 3;
+    size_t recordSize = CRingBufferST::RECORD_HEADER_SIZE + sizes[target];
+    size_t begin = gen() % recordSize;
+    size_t count = (std::min)((size_t)corruptCount, recordSize - begin);
+    bool changed = false;
+
+    for (size_t k = 0; k < count; k++)
+    {
+        size_t position = recordStart[target] + begin + k;
+        unsigned char* byte = (position < spans.vec[0].iov_len)
+            ? static_cast<unsigned char*>(spans.vec[0].iov_base) + position
+            : static_cast<unsigned char*>(spans.vec[1].iov_base) + (position - spans.vec[0].iov_len);
+
+        unsigned char corrupted = (corruptCount == 1) ? static_cast<unsigned char>(*byte ^ (1 + gen() % 255)) : static_cast<unsigned char>(gen());
+        changed |= (corrupted != *byte);
+        *byte = corrupted;
+    }
+
+    if (!changed)
+    {
+        ring.Clear();
+        return false;
+    }
+
+    uint64_t errorsBefore = ring.GetRecordErrorCount();
+    unsigned char output[300];
+
+    for (int r = 0; r < target; r++)
+    {
+        TEST_ASSERT(ring.DequeueRecord(output, sizeof(output)) == sizes[r], "손상 앞 레코드를 읽지 못함");
+        TEST_ASSERT(std::memcmp(output, input[r], sizes[r]) == 0, "손상 앞 레코드 내용 불일치");
+    }
+
+    TEST_ASSERT(ring.DequeueRecord(output, sizeof(output)) == 0, "손상된 레코드를 감지하지 못함");
+    TEST_ASSERT(ring.GetRecordErrorCount() == errorsBefore + 1, "오류 횟수가 늘지 않음");
+    TEST_ASSERT(ring.GetDataSize() == 0, "손상 감지 후 남은 데이터를 버리지 않음");
+    return true;
+}
+
+// 메시지 크기별 단일 스레드 처리량 (MB/s): 링을 채우고 비우기를 반복
+template<bool Checked>
+double MeasureRecordThroughput(size_t messageSize)
+{
+    CRingBufferPow2ST ring(65536);
+    std::vector<char> input(messageSize, 'x');
+    std::vector<char> output(messageSize);
+
+    const uint64_t totalMessages = (std::max)((uint64_t)1, TestConfig::RECORD_THROUGHPUT_BYTES / messageSize);
+    const uint64_t batch = (std::max)((size_t)1, 32768 / (messageSize + CRingBufferPow2ST::RECORD_HEADER_SIZE));
+    uint64_t done = 0;
+
+    auto startTime = std::chrono::steady_clock::now();
+    while (done < totalMessages)
+    {
+        uint64_t count = (std::min)(batch, totalMessages - done);
+        for (uint64_t i = 0; i < count; i++)
+        {
+            input[0] = static_cast<char>(done + i);
+            size_t written = Checked ? ring.EnqueueRecord(input.data(), messageSize) : ring.EnqueueMessage(input.data(), messageSize);
+            TEST_ASSERT(written == messageSize, "처리량 측정 Enqueue 실패");
+        }
+        for (uint64_t i = 0; i < count; i++)
+        {
+            size_t read = Checked ? ring.DequeueRecord(output.data(), messageSize) : ring.DequeueMessage(output.data(), messageSize);
+            TEST_ASSERT(read == messageSize && output[0] == static_cast<char>(done + i), "처리량 측정 Dequeue 실패");
+        }
+        done += count;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    return (double)totalMessages * messageSize / (1024.0 * 1024.0) / seconds;
+}
+
+void Test_ChecksumRecord()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Record] 체크섬 레코드 (CRC32C) 테스트" << std::endl;
+    std::cout << "  - 하드웨어 CRC32C (SSE4.2): " << (RingBufferHasHardwareCrc32c() ? "사용" : "없음 (테이블)") << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // Phase 1: CRC32C 계산
+    {
+        TEST_ASSERT(RingBufferCrc32c("123456789", 9) == 0xE3069283, "CRC32C 알려진 값 불일치");
+
+        std::mt19937 gen(1);
+        std::vector<unsigned char> source(4096 + 16);
+        std::vector<unsigned char> copy(4096 + 16);
+        for (auto& b : source) b = static_cast<unsigned char>(gen());
+
+        for (int i = 0; i < 100'000; i++)
+        {
+            size_t offset = gen() % 16;
+            size_t size = gen() % 4097;
+            uint32_t seed = gen();
+
+            uint32_t software = RingBufferCrc32cUpdateSoftware(seed, source.data() + offset, size);
+            TEST_ASSERT(RingBufferCrc32cUpdate(seed, source.data() + offset, size) == software, "CRC32C 하드웨어/테이블 불일치");
+
+            size_t dstOffset = gen() % 16;
+            TEST_ASSERT(RingBufferCopyCrc32cUpdate(copy.data() + dstOffset, source.data() + offset, size, seed) == software, "복사 + CRC 누적 불일치");
+            TEST_ASSERT(std::memcmp(copy.data() + dstOffset, source.data() + offset, size) == 0, "복사 + CRC 누적의 복사 결과 불일치");
+        }
+
+        std::cout << "[PASS] Phase 1: CRC32C 알려진 값 / 하드웨어 == 테이블 / 복사 + 누적 (정렬 어긋남 포함)" << std::endl;
+        g_testCount++;
+    }
+
+    // Phase 2: 왕복 무결성 - 작은 모듈러 링은 거의 매번 wrap을 걸침
+    RunRecordRoundTrip<CRingBufferST>("모듈러 (CRingBufferST)", 1000);
+    RunRecordRoundTrip<CRingBufferMirrorST>("미러링 (CRingBufferMirrorST)", 4096);
+
+    // Phase 3: 장애 주입
+    {
+        CRingBufferST ring(4096);
+        std::mt19937 gen(2024);
+        uint64_t flipDetected = 0;
+        uint64_t garbageDetected = 0;
+
+        for (uint64_t i = 0; i < TestConfig::RECORD_ITERATIONS; i++)
+        {
+            if (InjectRecordFault(ring, gen, 1))
+                flipDetected++;
+            if (InjectRecordFault(ring, gen, 1 + gen() % 16))
+                garbageDetected++;
+
+            if (i % 100'000 == 0)
+                PrintProgress("장애 주입", i, TestConfig::RECORD_ITERATIONS);
+        }
+
+        // 버퍼가 작을 때는 레코드를 남겨두지만, 손상된 레코드는 버퍼 크기와 상관없이 감지
+        char record[64] = {};
+        char small[16];
+        TEST_ASSERT(ring.EnqueueRecord(record, sizeof(record)) == sizeof(record), "EnqueueRecord 실패");
+        uint64_t errorsBefore = ring.GetRecordErrorCount();
+        TEST_ASSERT(ring.DequeueRecord(small, sizeof(small)) == 0 && ring.GetDataSize() != 0, "작은 버퍼에서 레코드를 남겨두지 않음");
+        TEST_ASSERT(ring.GetRecordErrorCount() == errorsBefore, "정상 레코드를 손상으로 판단");
+
+        RingSpans spans = ring.PeekSpans();
+        static_cast<char*>(spans.vec[0].iov_base)[CRingBufferST::RECORD_HEADER_SIZE + 10] ^= 0x40;
+        TEST_ASSERT(ring.DequeueRecord(small, sizeof(small)) == 0 && ring.GetDataSize() == 0, "작은 버퍼에서 손상된 레코드를 버리지 않음");
+        TEST_ASSERT(ring.GetRecordErrorCount() == errorsBefore + 1, "작은 버퍼에서 손상을 감지하지 못함");
+
+        std::cout << "\n[PASS] Phase 3: 장애 주입 - 1바이트 뒤집기 " << flipDetected << "회 / 1~16바이트 덮어쓰기 " << garbageDetected
+                  << "회 모두 감지 (누적 오류 " << ring.GetRecordErrorCount() << ")" << std::endl;
+        g_testCount++;
+    }
+
+    // Phase 4: 처리량 비교
+    {
+        std::cout << "\n[Phase 4] 단일 스레드 처리량 (64KB 링 채우기/비우기, 크기별 " << TestConfig::RECORD_THROUGHPUT_BYTES / (1024 * 1024) << " MB)" << std::endl;
+        std::cout << "  크기(B) | 메시지 MB/s | 레코드(CRC) MB/s | 비율" << std::endl;
+
+        const size_t sizes[] = { 16, 64, 256, 1024, 4096, 16384 };
+        for (size_t messageSize : sizes)
+        {
+            double plain = MeasureRecordThroughput<false>(messageSize);
+            double checked = MeasureRecordThroughput<true>(messageSize);
+            std::cout << "  " << messageSize << " | " << (int)plain << " | " << (int)checked << " | " << checked / plain << std::endl;
+        }
+
+        // CRC 계산만 (64KB 버퍼 반복): 테이블 vs 디스패치(하드웨어가 있으면 SSE4.2)
+        std::vector<unsigned char> block(65536, 0x5A);
+        const int rounds = 2000;
+        uint32_t sink = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++)
+            sink ^= RingBufferCrc32cUpdateSoftware(0xFFFFFFFF, block.data(), block.size());
+        double softwareSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++)
+            sink ^= RingBufferCrc32cUpdate(0xFFFFFFFF, block.data(), block.size());
+        double dispatchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        double totalMB = (double)block.size() * rounds / (1024.0 * 1024.0);
+        std::cout << "  CRC32C 계산만: 테이블 " << (int)(totalMB / softwareSeconds) << " MB/s, "
+                  << (RingBufferHasHardwareCrc32c() ? "SSE4.2 " : "테이블 ") << (int)(totalMB / dispatchSeconds) << " MB/s (sink " << (sink & 1) << ")" << std::endl;
+        g_testCount++;
+    }
+
+    std::cout << "\n[PASS] 체크섬 레코드 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 소켓 입출력 (RingRecvFrom/RingSendTo) 테스트 - Linux socketpair 루프백
+// Phase 1: wrap을 걸친 readv/writev, 빈 링/가득 찬 링, EAGAIN, 연결 종료
+// Phase 2: 송신 링 -> 소켓 -> 수신 링 스트리밍, MB당 시스템 콜 수와 처리량을
+//          readv/writev 직접 vs 임시 버퍼 복사(DequeueBatch -> write, read -> Enqueue)와 비교
+//=============================================================================
+
+#ifdef __linux__
+template<typename RingType>
+void RunSocketWrapCheck(const char* name)
+{
+    int fds[2];
+    TEST_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0, "socketpair 실패");
+
+    unsigned char input[100];
+    unsigned char output[100];
+    for (int i = 0; i < 100; i++)
+        input[i] = static_cast<unsigned char>(i * 7 + 1);
+
+    // 쓰기 위치를 끝에서 24바이트 앞에 두고 받음 -> 빈 구간 2개에 readv 1번
+    RingType receiver(1024);
+    TEST_ASSERT(receiver.SetCursorBase(1000), "SetCursorBase 실패");
+    TEST_ASSERT(write(fds[0], input, sizeof(input)) == (ssize_t)sizeof(input), "write 실패");
+    TEST_ASSERT(RingRecvFrom(receiver, fds[1]) == (int64_t)sizeof(input), "wrap을 걸친 RingRecvFrom 크기 불일치");
+    TEST_ASSERT(receiver.Dequeue(output, sizeof(output)) == sizeof(output) && std::memcmp(input, output, sizeof(input)) == 0, "RingRecvFrom 내용 불일치");
+
+    // 데이터가 wrap을 걸친 상태에서 보냄 -> 데이터 구간 2개에 writev 1번
+    RingType sender(1024);
+    TEST_ASSERT(sender.SetCursorBase(1000), "SetCursorBase 실패");
+    TEST_ASSERT(RingSendTo(sender, fds[0]) == 0, "빈 링의 RingSendTo가 0이 아님");
+    TEST_ASSERT(sender.Enqueue(input, sizeof(input)) == sizeof(input), "Enqueue 실패");
+    TEST_ASSERT(RingSendTo(sender, fds[0]) == (int64_t)sizeof(input) && sender.GetDataSize() == 0, "wrap을 걸친 RingSendTo 크기 불일치");
+    std::memset(output, 0, sizeof(output));
+    TEST_ASSERT(read(fds[1], output, sizeof(output)) == (ssize_t)sizeof(output) && std::memcmp(input, output, sizeof(input)) == 0, "RingSendTo 내용 불일치");
+
+    // 논블로킹: 받을 데이터가 없으면 -1, EAGAIN
+    fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL) | O_NONBLOCK);
+    TEST_ASSERT(RingRecvFrom(receiver, fds[1]) == -1 && (errno == EAGAIN || errno == EWOULDBLOCK), "논블로킹 RingRecvFrom이 EAGAIN이 아님");
+
+    // 가득 찬 링: 시스템 콜 없이 -1, ENOBUFS
+    std::vector<unsigned char> fill(receiver.GetFreeSize(), 0);
+    TEST_ASSERT(receiver.Enqueue(fill.data(), fill.size()) == fill.size(), "Enqueue 실패");
+    TEST_ASSERT(RingRecvFrom(receiver, fds[1]) == -1 && errno == ENOBUFS, "가득 찬 링의 RingRecvFrom이 ENOBUFS가 아님");
+    receiver.Clear();
+
+    // 상대가 닫으면 0
+    close(fds[0]);
+    TEST_ASSERT(RingRecvFrom(receiver, fds[1]) == 0, "연결 종료 후 RingRecvFrom이 0이 아님");
+
+    // 상대가 닫은 소켓에 RingSendTo: SIGPIPE 기본 동작(프로세스 종료) 그대로 두어도 -1, EPIPE로 돌아와야 함
+    TEST_ASSERT(sender.Enqueue(input, sizeof(input)) == sizeof(input), "Enqueue 실패");
+    TEST_ASSERT(RingSendTo(sender, fds[1]) == -1 && errno == EPIPE, "연결 종료 후 RingSendTo가 EPIPE가 아님");
+    TEST_ASSERT(sender.GetDataSize() == sizeof(input), "실패한 RingSendTo가 데이터를 소비함");
+    close(fds[1]);
+
+    std::cout << "[PASS] Phase 1: " << name << " - wrap readv/writev, 빈 링 0, EAGAIN, ENOBUFS, 연결 종료 0, SIGPIPE 없는 EPIPE" << std::endl;
+    g_testCount++;
+}
+
+struct SocketStreamResult
+{
+    double throughputMB;
+    double syscallsPerMB;
+};
+
+// 송신 스레드: 1456바이트 응용 메시지를 송신 링에 쌓고 소켓으로 비움
+// 수신 스레드(호출 스레드): 소켓에서 수신 링으로 받고, 8바이트 단위 스트림 오프셋 값을 검증하며 비움
+// tempSize == 0이면 RingRecvFrom/RingSendTo, 아니면 tempSize 임시 버퍼를 거쳐 read/write
+SocketStreamResult RunSocketStream(size_t tempSize)
+{
+    const uint64_t TOTAL_BYTES = TestConfig::SOCKET_STREAM_BYTES / 8 * 8;
+    const size_t MESSAGE_SIZE = 1456;
+
+    int fds[2];
+    TEST_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0, "socketpair 실패");
+
+    auto sendRing = std::make_unique<CRingBufferST>(65536);
+    auto recvRing = std::make_unique<CRingBufferST>(65536);
+    std::atomic<uint64_t> sendSyscalls(0);
+    uint64_t recvSyscalls = 0;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::thread sender([&]()
+    {
+        std::vector<uint64_t> message(MESSAGE_SIZE / 8);
+        std::vector<char> temp(tempSize);
+        uint64_t produced = 0;
+        uint64_t sent = 0;
+        uint64_t syscalls = 0;
+
+        while (sent < TOTAL_BYTES)
+        {
+            while (produced < TOTAL_BYTES)
+            {
+                size_t size = (size_t)(std::min)((uint64_t)MESSAGE_SIZE, TOTAL_BYTES - produced);
+                for (size_t k = 0; k < size / 8; k++)
+                    message[k] = produced + k * 8;
+                if (sendRing->Enqueue(message.data(), size) == 0)
+                    break;
+                produced += size;
+            }
+
+            if (tempSize == 0)
+            {
+                int64_t n = RingSendTo(*sendRing, fds[0]);
+                syscalls++;
+                TEST_ASSERT(n > 0, "RingSendTo 실패");
+                sent += n;
+            }
+            else
+            {
+                size_t n = sendRing->DequeueBatch(temp.data(), tempSize);
+                for (size_t offset = 0; offset < n; )
+                {
+                    ssize_t written = write(fds[0], temp.data() + offset, n - offset);
+                    syscalls++;
+                    TEST_ASSERT(written > 0, "write 실패");
+                    offset += written;
+                }
+                sent += n;
+            }
+        }
+
+        shutdown(fds[0], SHUT_WR);
+        sendSyscalls = syscalls;
+    });
+
+    std::vector<uint64_t> verify(65536 / 8);
+    std::vector<char> temp(tempSize);
+    uint64_t received = 0;
+
+    while (true)
+    {
+        int64_t n;
+        if (tempSize == 0)
+        {
+            n = RingRecvFrom(*recvRing, fds[1]);
+        }
+        else
+        {
+            // 수신 링에 남은 조각(8바이트 미만)이 있으므로 빈 공간만큼만 읽음
+            n = read(fds[1], temp.data(), (std::min)(tempSize, recvRing->GetFreeSize()));
+            if (n > 0)
+                TEST_ASSERT(recvRing->Enqueue(temp.data(), n) == (size_t)n, "수신 링 Enqueue 실패");
+        }
+        recvSyscalls++;
+        TEST_ASSERT(n >= 0, "수신 실패");
+        if (n == 0)
+            break;
+
+        // 8바이트 단위로 꺼내 스트림 오프셋 값 확인 (남은 조각은 다음 수신과 합쳐서)
+        size_t available = recvRing->GetDataSize() / 8 * 8;
+        if (available == 0)
+            continue;
+        size_t got = recvRing->DequeueBatch(verify.data(), available);
+        TEST_ASSERT(got == available, "수신 링 DequeueBatch 크기 불일치");
+        for (size_t k = 0; k < got / 8; k++)
+            TEST_ASSERT(verify[k] == received + k * 8, "스트림 데이터 불일치");
+        received += got;
+    }
+
+    sender.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    close(fds[0]);
+    close(fds[1]);
+
+    TEST_ASSERT(received == TOTAL_BYTES && recvRing->GetDataSize() == 0, "수신 바이트 수 불일치");
+
+    double totalMB = (double)TOTAL_BYTES / (1024.0 * 1024.0);
+    SocketStreamResult result;
+    result.throughputMB = totalMB / seconds;
+    result.syscallsPerMB = (double)(sendSyscalls + recvSyscalls) / totalMB;
+    return result;
+}
+#endif
+
+void Test_SocketIo()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Socket] 링 <-> 소켓 입출력 (RingRecvFrom/RingSendTo) 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+#ifdef __linux__
+    RunSocketWrapCheck<CRingBufferST>("CRingBufferST");
+    RunSocketWrapCheck<CRingBufferPow2MT>("CRingBufferPow2MT");
+
+    std::cout << "\n[Phase 2] socketpair 스트리밍 (송신 링 64KB -> 소켓 -> 수신 링 64KB, "
+              << TestConfig::SOCKET_STREAM_BYTES / (1024 * 1024) << " MB, 응용 메시지 1456B)" << std::endl;
+
+    struct StreamRun
+    {
+        const char* name;
+        size_t tempSize;
+    };
+    const StreamRun runs[] = {
+        { "readv/writev 직접 (RingRecvFrom/RingSendTo)", 0 },
+        { "임시 버퍼 16KB (read/write + 복사)", 16384 },
+        { "임시 버퍼 64KB (read/write + 복사)", 65536 },
+    };
+
+    for (const StreamRun& run : runs)
+    {
+        SocketStreamResult result = RunSocketStream(run.tempSize);
+        std::cout << "  " << run.name << ": " << (int)result.throughputMB << " MB/s, 시스템 콜 " << result.syscallsPerMB << " 회/MB" << std::endl;
+        g_testCount++;
+    }
+
+    std::cout << "\n[PASS] 소켓 입출력 테스트 완료!" << std::endl;
+#else
+    std::cout << "  - socketpair 기반 테스트는 Linux에서만 실행 (건너뜀)" << std::endl;
+#endif
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 코루틴 대기 (AsyncEnqueue/AsyncDequeue) 테스트
+// Phase 1: 실행기 하나에서 생산자/소비자 코루틴 - 순서, 다중 생산자/소비자, 즉시 반환 경계
+// Phase 2: OS 스레드 <-> 코루틴 (다른 스레드의 커서 공개가 실행기로 Post되는 경로)
+// Phase 3: 코루틴 전환 vs 블로킹 스레드 전환 비용 (핑퐁 왕복, 스트리밍)
+//=============================================================================
+
+// 코루틴 생산자: base | 0..count-1 을 8바이트씩 기록
+template<typename RingType>
+CRingTask CoroutineProducer(RingType* ring, uint64_t base, uint64_t count)
+{
+    for (uint64_t i = 0; i < count; i++)
+    {
+        uint64_t value = base | i;
+        size_t written = co_await ring->AsyncEnqueue(&value, sizeof(value));
+        TEST_ASSERT(written == sizeof(value), "AsyncEnqueue 실패");
+    }
+}
+
+// 코루틴 소비자: count개를 꺼내 log에 기록 (log가 nullptr이면 0..count-1 순서만 검증)
+template<typename RingType>
+CRingTask CoroutineConsumer(RingType* ring, uint64_t count, std::vector<uint64_t>* log)
+{
+    for (uint64_t i = 0; i < count; i++)
+    {
+        uint64_t value = 0;
+        size_t read = co_await ring->AsyncDequeue(&value, sizeof(value));
+        TEST_ASSERT(read == sizeof(value), "AsyncDequeue 실패");
+        if (log != nullptr)
+            log->push_back(value);
+        else
+            TEST_ASSERT(value == i, "AsyncDequeue 순서 불일치");
+    }
+}
+
+CRingTask CoroutineImmediateCheck(CRingBufferWaitST* ring, bool* finished)
+{
+    char buffer[256] = {};
+
+    // 멈추지 않고 바로 0 - 비어 있는 링이어도 대기하지 않음
+    TEST_ASSERT(co_await ring->AsyncDequeue(nullptr, 8) == 0, "nullptr AsyncDequeue가 0이 아님");
+    TEST_ASSERT(co_await ring->AsyncDequeue(buffer, 0) == 0, "크기 0 AsyncDequeue가 0이 아님");
+    TEST_ASSERT(co_await ring->AsyncEnqueue(buffer, ring->GetCapacity() + 1) == 0, "용량 초과 AsyncEnqueue가 0이 아님");
+    TEST_ASSERT(co_await ring->AsyncDequeue(buffer, ring->GetCapacity() + 1) == 0, "용량 초과 AsyncDequeue가 0이 아님");
+
+    // 바로 되는 경우도 멈추지 않음
+    TEST_ASSERT(co_await ring->AsyncEnqueue("abc", 3) == 3, "AsyncEnqueue 즉시 성공 실패");
+    TEST_ASSERT(co_await ring->AsyncDequeue(buffer, 3) == 3 && std::memcmp(buffer, "abc", 3) == 0, "AsyncDequeue 즉시 성공 실패");
+    *finished = true;
+}
+
+void RunCoroutineSingleExecutorTest()
+{
+    std::cout << "\n[Phase 1] 실행기 하나에서 생산자/소비자 코루틴" << std::endl;
+
+    // 1. 작은 링 (64B = 8바이트 7개)에서 1:1 - 가득 참/빔이 계속 반복됨
+    {
+        CRingBufferWaitST ring(64);
+        CRingCoroutineExecutor executor;
+        executor.Spawn(CoroutineConsumer(&ring, TestConfig::COROUTINE_MESSAGES, nullptr));
+        executor.Spawn(CoroutineProducer(&ring, 0, TestConfig::COROUTINE_MESSAGES));
+        executor.Run();
+
+        TEST_ASSERT(ring.GetDataSize() == 0, "1:1 종료 후 링이 비어 있지 않음");
+        std::cout << "[PASS] 1:1 " << TestConfig::COROUTINE_MESSAGES << "개 순서 일치 (실행 작업 " << executor.GetRunCount() << "개)" << std::endl;
+        g_testCount++;
+    }
+
+    // 2. 생산자 3 / 소비자 2 - 생산자별 순서는 소비 기록에서 유지되어야 함
+    {
+        const int PRODUCERS = 3;
+        const int CONSUMERS = 2;
+        const uint64_t PER_PRODUCER = TestConfig::COROUTINE_MESSAGES / PRODUCERS / CONSUMERS * CONSUMERS;
+        const uint64_t PER_CONSUMER = PER_PRODUCER * PRODUCERS / CONSUMERS;
+
+        CRingBufferWaitST ring(64);
+        CRingCoroutineExecutor executor;
+        std::vector<uint64_t> log;
+        log.reserve(PER_PRODUCER * PRODUCERS);
+
+        for (int c = 0; c < CONSUMERS; c++)
+            executor.Spawn(CoroutineConsumer(&ring, PER_CONSUMER, &log));
+        for (int p = 0; p < PRODUCERS; p++)
+            executor.Spawn(CoroutineProducer(&ring, (uint64_t)p << 56, PER_PRODUCER));
+        executor.Run();
+
+        TEST_ASSERT(log.size() == PER_PRODUCER * PRODUCERS, "다중 생산자/소비자 개수 불일치");
+        uint64_t nextSeq[PRODUCERS] = {};
+        for (uint64_t value : log)
+        {
+            int producer = (int)(value >> 56);
+            TEST_ASSERT(producer < PRODUCERS && (value & ((uint64_t(1) << 56) - 1)) == nextSeq[producer], "생산자별 순서 불일치");
+            nextSeq[producer]++;
+        }
+
+        std::cout << "[PASS] 생산자 " << PRODUCERS << " / 소비자 " << CONSUMERS << ": " << log.size() << "개, 생산자별 순서 일치" << std::endl;
+        g_testCount++;
+    }
+
+    // 3. 즉시 반환 경계 - 잘못된 요청은 대기하지 않고 0
+    {
+        CRingBufferWaitST ring(64);
+        CRingCoroutineExecutor executor;
+        bool finished = false;
+        executor.Spawn(CoroutineImmediateCheck(&ring, &finished));
+        executor.Run();
+
+        TEST_ASSERT(finished, "즉시 반환 코루틴이 끝나지 않음");
+        std::cout << "[PASS] nullptr / 크기 0 / 용량 초과는 멈추지 않고 0, 바로 되는 요청은 멈추지 않음" << std::endl;
+        g_testCount++;
+    }
+}
+
+void RunCoroutineCrossThreadTest()
+{
+    std::cout << "\n[Phase 2] OS 스레드 <-> 코루틴 (CRingBufferWaitMT 256B)" << std::endl;
+
+    // 1. 스레드 생산자 -> 코루틴 소비자
+    {
+        CRingBufferWaitMT ring(256);
+        CRingCoroutineExecutor executor;
+        executor.Spawn(CoroutineConsumer(&ring, TestConfig::COROUTINE_MESSAGES, nullptr));
+
+        std::thread producer([&]() {
+            for (uint64_t i = 0; i < TestConfig::COROUTINE_MESSAGES; i++)
+                TEST_ASSERT(ring.EnqueueWait(&i, sizeof(i)) == sizeof(i), "EnqueueWait 실패");
+        });
+        executor.Run();
+        producer.join();
+
+        std::cout << "[PASS] 스레드 생산자 -> 코루틴 소비자: 순서 일치 (다른 스레드에서 Post " << executor.GetRemotePostCount() << "회)" << std::endl;
+        g_testCount++;
+    }
+
+    // 2. 코루틴 생산자 -> 스레드 소비자
+    {
+        CRingBufferWaitMT ring(256);
+        CRingCoroutineExecutor executor;
+        executor.Spawn(CoroutineProducer(&ring, 0, TestConfig::COROUTINE_MESSAGES));
+
+        std::thread consumer([&]() {
+            for (uint64_t i = 0; i < TestConfig::COROUTINE_MESSAGES; i++)
+            {
+                uint64_t value = 0;
+                TEST_ASSERT(ring.DequeueWait(&value, sizeof(value)) == sizeof(value), "DequeueWait 실패");
+                TEST_ASSERT(value == i, "DequeueWait 순서 불일치");
+            }
+        });
+        executor.Run();
+        consumer.join();
+
+        std::cout << "[PASS] 코루틴 생산자 -> 스레드 소비자: 순서 일치 (다른 스레드에서 Post " << executor.GetRemotePostCount() << "회)" << std::endl;
+        g_testCount++;
+    }
+}
+
+// 핑퐁: ping이 request에 보내고 reply에서 받음, pong은 반대 - 매 왕복마다 양쪽이 한 번씩 멈추고 깨어남
+template<typename RingType>
+CRingTask CoroutinePing(RingType* request, RingType* reply, uint64_t rounds)
+{
+    for (uint64_t i = 0; i < rounds; i++)
+    {
+        co_await request->AsyncEnqueue(&i, sizeof(i));
+        uint64_t value = 0;
+        co_await reply->AsyncDequeue(&value, sizeof(value));
+        TEST_ASSERT(value == i, "핑퐁 응답 불일치");
+    }
+}
+
+template<typename RingType>
+CRingTask CoroutinePong(RingType* request, RingType* reply, uint64_t rounds)
+{
+    for (uint64_t i = 0; i < rounds; i++)
+    {
+        uint64_t value = 0;
+        co_await request->AsyncDequeue(&value, sizeof(value));
+        co_await reply->AsyncEnqueue(&value, sizeof(value));
+    }
+}
+
+double RunCoroutinePingPong(uint64_t rounds, uint64_t* runCount)
+{
+    CRingBufferWaitST request(64);
+    CRingBufferWaitST reply(64);
+    CRingCoroutineExecutor executor;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    executor.Spawn(CoroutinePong(&request, &reply, rounds));
+    executor.Spawn(CoroutinePing(&request, &reply, rounds));
+    executor.Run();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    *runCount = executor.GetRunCount();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / (double)rounds;
+}
+
+double RunThreadPingPong(uint64_t rounds)
+{
+    CRingBufferWaitSPSC request(64);
+    CRingBufferWaitSPSC reply(64);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::thread pong([&]() {
+        for (uint64_t i = 0; i < rounds; i++)
+        {
+            uint64_t value = 0;
+            request.DequeueWait(&value, sizeof(value));
+            reply.EnqueueWait(&value, sizeof(value));
+        }
+    });
+    for (uint64_t i = 0; i < rounds; i++)
+    {
+        request.EnqueueWait(&i, sizeof(i));
+        uint64_t value = 0;
+        reply.DequeueWait(&value, sizeof(value));
+        TEST_ASSERT(value == i, "핑퐁 응답 불일치");
+    }
+    pong.join();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / (double)rounds;
+}
+
+// 스트리밍: 64KB 링에 8바이트 값을 흘려보냄 - 링이 가득 찰/빌 때만 전환
+double RunCoroutineStreaming(uint64_t count, uint64_t* runCount)
+{
+    CRingBufferWaitST ring(65536);
+    CRingCoroutineExecutor executor;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    executor.Spawn(CoroutineConsumer(&ring, count, nullptr));
+    executor.Spawn(CoroutineProducer(&ring, 0, count));
+    executor.Run();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    *runCount = executor.GetRunCount();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return (double)(count * sizeof(uint64_t)) / (1024.0 * 1024.0) / seconds;
+}
+
+double RunThreadStreaming(uint64_t count)
+{
+    CRingBufferWaitSPSC ring(65536);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::thread producer([&]() {
+        for (uint64_t i = 0; i < count; i++)
+            ring.EnqueueWait(&i, sizeof(i));
+    });
+    for (uint64_t i = 0; i < count; i++)
+    {
+        uint64_t value = 0;
+        ring.DequeueWait(&value, sizeof(value));
+        TEST_ASSERT(value == i, "스트리밍 순서 불일치");
+    }
+    producer.join();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return (double)(count * sizeof(uint64_t)) / (1024.0 * 1024.0) / seconds;
+}
+
+void Test_Coroutine()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "[Coroutine] 코루틴 대기 (AsyncEnqueue/AsyncDequeue) 테스트" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    RunCoroutineSingleExecutorTest();
+    RunCoroutineCrossThreadTest();
+
+    std::cout << "\n[Phase 3] 전환 비용: 코루틴(실행기 1개, CRingBufferWaitST) vs 블로킹 스레드(EnqueueWait/DequeueWait, CRingBufferWaitSPSC)" << std::endl;
+
+    const uint64_t ROUNDS = TestConfig::COROUTINE_PINGPONG_ROUNDS;
+    uint64_t coroutineRuns = 0;
+    double coroutineRoundNs = RunCoroutinePingPong(ROUNDS, &coroutineRuns);
+    double threadRoundNs = RunThreadPingPong(ROUNDS);
+    std::cout << "  핑퐁 " << ROUNDS << "회 왕복: 코루틴 " << (int)coroutineRoundNs << " ns/왕복 (실행 작업 " << coroutineRuns
+              << "개), 스레드 " << (int)threadRoundNs << " ns/왕복 (" << threadRoundNs / (std::max)(coroutineRoundNs, 1.0) << "배)" << std::endl;
+    g_testCount++;
+
+    const uint64_t MESSAGES = TestConfig::COROUTINE_MESSAGES * 10;
+    uint64_t streamingRuns = 0;
+    double coroutineMB = RunCoroutineStreaming(MESSAGES, &streamingRuns);
+    double threadMB = RunThreadStreaming(MESSAGES);
+    std::cout << "  스트리밍 " << MESSAGES << "개 (8B): 코루틴 " << (int)coroutineMB << " MB/s (실행 작업 " << streamingRuns
+              << "개), 스레드 " << (int)threadMB << " MB/s" << std::endl;
+    g_testCount++;
+
+    std::cout << "\n[PASS] 코루틴 대기 테스트 완료!" << std::endl;
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 락 정책 비교 벤치마크
+// MutexLock / SpinLock / TicketLock / AdaptiveLock 각각으로
+// 고빈도 경합(Phase 2-2)과 Producer-Consumer(Phase 2-1)를 모든 스레드 조합에서 실행
+//=============================================================================
+
+struct LockBenchmarkRow
+{
+    std::string policyName;
+    std::vector<HighContentionResult> contention;        // 스레드 수별
+    std::vector<ProducerConsumerResult> producerConsumer; // 생산자-소비자 조합별
+};
+
+template<typename LockPolicy>
+LockBenchmarkRow RunLockPolicyBenchmark(
+    const char* policyName,
+    const std::vector<int>& threadCounts,
+    const std::vector<std::pair<int, int>>& threadConfigs,
+    std::vector<std::string>& completedLines)
+{
+    using RingType = CRingBufferT<LockPolicy>;
+
+    LockBenchmarkRow row;
+    row.policyName = policyName;
+
+    for (size_t i = 0; i < threadCounts.size(); i++)
+    {
+        std::string name = std::string("[") + policyName + " " + std::to_string(threadCounts[i]) + "개 스레드]";
+        HighContentionResult result = RunHighContentionTest<RingType>(
+            threadCounts[i], TestConfig::HIGH_CONTENTION_OPS_PER_THREAD, completedLines, name + " 고빈도 경합 진행 중..");
+        row.contention.push_back(result);
+        completedLines.push_back(name + " 고빈도 경합 완료 (" + std::to_string(result.opsPerSec) + " ops/sec)");
+    }
+
+    for (size_t i = 0; i < threadConfigs.size(); i++)
+    {
+        std::string name = std::string("[") + policyName + " " + std::to_string(threadConfigs[i].first)
+            + "-" + std::to_string(threadConfigs[i].second) + "]";
+        ProducerConsumerResult result = RunProducerConsumerTest<RingType>(
+            threadConfigs[i].first, threadConfigs[i].second, TestConfig::NUMBERS_PER_THREAD, completedLines, name + " 조합 테스트 진행 중..");
+        row.producerConsumer.push_back(result);
+        completedLines.push_back(name + " 조합 테스트 완료 (" + std::to_string((int)result.throughputMB) + " MB/s)");
+    }
+
+    return row;
+}
+
+void Test_LockPolicyBenchmark()
+{
+    std::vector<int> threadCounts = { 2, 4, 8, 16, 32 };
+    std::vector<std::pair<int, int>> threadConfigs = {
+        {1, 1}, {2, 2}, {4, 4}, {8, 8}, {1, 8}, {8, 1}, {2, 6}, {6, 2}
+    };
+
+    std::vector<std::string> completedLines;
+    std::vector<LockBenchmarkRow> rows;
+
+    rows.push_back(RunLockPolicyBenchmark<MutexLock>("MutexLock", threadCounts, threadConfigs, completedLines));
+    rows.push_back(RunLockPolicyBenchmark<SpinLock>("SpinLock", threadCounts, threadConfigs, completedLines));
+    rows.push_back(RunLockPolicyBenchmark<TicketLock>("TicketLock", threadCounts, threadConfigs, completedLines));
+    rows.push_back(RunLockPolicyBenchmark<AdaptiveLock>("AdaptiveLock", threadCounts, threadConfigs, completedLines));
+
+    // 마지막 전체 완료 출력
+#ifdef _WIN32
+    system("cls");
+#else
+    system("clear");
+#endif
+    std::cout << "========================================" << std::endl;
+    std::cout << "[락 정책 비교] 모든 벤치마크 완료!" << std::endl;
+    std::cout << "  - " << rows.size() << "가지 정책 x (" << threadCounts.size() << " + " << threadConfigs.size() << ")가지 조합" << std::endl;
+
+    std::cout << "\n[고빈도 경합 처리량 (ops/sec) / 공정성 (Jain, 1.0 = 완전 공정)]" << std::endl;
+    std::cout << "  정책";
+    for (size_t i = 0; i < threadCounts.size(); i++)
+    {
+        std::cout << " | " << threadCounts[i] << "T";
+    }
+    std::cout << std::endl;
+    for (size_t r = 0; r < rows.size(); r++)
+    {
+        std::cout << "  " << rows[r].policyName;
+        for (size_t i = 0; i < rows[r].contention.size(); i++)
+        {
+            std::cout << " | " << rows[r].contention[i].opsPerSec << " / " << rows[r].contention[i].fairness;
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << "\n[Producer-Consumer 처리량 (MB/s) / 소비자 공정성 (Jain)]" << std::endl;
+    std::cout << "  정책";
+    for (size_t i = 0; i < threadConfigs.size(); i++)
+    {
+        std::cout << " | " << threadConfigs[i].first << "-" << threadConfigs[i].second;
+    }
+    std::cout << std::endl;
+    for (size_t r = 0; r < rows.size(); r++)
+    {
+        std::cout << "  " << rows[r].policyName;
+        for (size_t i = 0; i < rows[r].producerConsumer.size(); i++)
+        {
+            std::cout << " | " << rows[r].producerConsumer[i].throughputMB << " / " << rows[r].producerConsumer[i].consumerFairness;
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "========================================" << std::endl;
+}
+
+//=============================================================================
+// 메뉴 출력
+//=============================================================================
+void PrintMenu()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  CRingBuffer 테스트 메뉴" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "[Phase 1: 기본 검증 - 단일 스레드]" << std::endl;
+    std::cout << "  1. 데이터 무결성 테스트 (1억 번)" << std::endl;
+    std::cout << "  2. 불변성 검증 테스트 (1억 번)" << std::endl;
+    std::cout << "  3. 경계 조건 테스트 (1억 번)" << std::endl;
+    std::cout << "  4. Phase 1 전체 실행" << std::endl;
+    std::cout << "  17. 타입 큐 테스트 (CRingQueueT, Phase 1-1, 1-2 이식)" << std::endl;
+    std::cout << "\n[Phase 2: 멀티스레드 검증]" << std::endl;
+    std::cout << "  5. Producer-Consumer 테스트 (1억 바이트)" << std::endl;
+    std::cout << "  6. 고빈도 경합 테스트" << std::endl;
+    std::cout << "  7. Phase 2 전체 실행" << std::endl;
+    std::cout << "  9. Peek+Consume 테스트 (PeekSpans)" << std::endl;
+    std::cout << "  11. Producer-Consumer 메시지 모드 테스트 (EnqueueMessage/DequeueMessage)" << std::endl;
+    std::cout << "  13. 블로킹 API 테스트 (EnqueueWait/DequeueWait, 저빈도 CPU 사용량)" << std::endl;
+    std::cout << "  18. 다중 생산자 fan-in 테스트 (CRingFanIn, N:1 공유 링 비교)" << std::endl;
+    std::cout << "  19. 브로드캐스트 링 테스트 (CBroadcastRing, 1:N Block/Overwrite)" << std::endl;
+    std::cout << "  22. 청크 스트림 테스트 (CChunkedStreamT, 풀 청크 연결 / 유휴 세션 메모리)" << std::endl;
+    std::cout << "  24. 다중 레인 우선순위 링 테스트 (CPriorityRingT, Strict / Weighted, 레인별 지연)" << std::endl;
+    std::cout << "\n[저장소 정책]" << std::endl;
+    std::cout << "  10. 미러링 저장소 테스트 (Phase 1-1, 1-2, 2-1 재실행)" << std::endl;
+    std::cout << "  14. 성장 모드 테스트 (EnableGrowth, 동시 성장/축소)" << std::endl;
+    std::cout << "  15. 공유 메모리 프로세스 간 링 테스트 (fork, Linux)" << std::endl;
+    std::cout << "  16. 영속 저널 링 테스트 (크래시 복구, fwrite 비교)" << std::endl;
+    std::cout << "\n[벤치마크]" << std::endl;
+    std::cout << "  12. 락 정책 비교 (Mutex / Spin / Ticket / Adaptive)" << std::endl;
+    std::cout << "  20. 스트리밍 복사 비교 (memcpy vs 비시간적 저장, 8 B ~ 256 KB)" << std::endl;
+    std::cout << "  21. 고정 크기 Push/Pop 비교 (Enqueue/Dequeue 대비, 1바이트 경합 포함)" << std::endl;
+    std::cout << "  23. 지연 시간 추적 (LatencyTrace, p50/p99/p99.9/max, 추적 비용)" << std::endl;
+    std::cout << "  25. 체크섬 레코드 비교 (CRC32C 켜기/끄기 처리량, 장애 주입 감지)" << std::endl;
+    std::cout << "  26. 소켓 입출력 비교 (RingRecvFrom/RingSendTo readv/writev vs 임시 버퍼, socketpair)" << std::endl;
+    std::cout << "  27. 코루틴 대기 (AsyncEnqueue/AsyncDequeue, 코루틴 vs 블로킹 스레드 전환 비용)" << std::endl;
+    std::cout << "\n[전체]" << std::endl;
+    std::cout << "  8. 전체 테스트 실행 (Phase 1 + Phase 2)" << std::endl;
+    std::cout << "  0. 종료" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "선택: ";
+}
+
+//=============================================================================
 // Main
 //=============================================================================
 int main()
@@ -935,6 +5652,9 @@ int main()
                 std::cout << "\n[Phase 2 전체 실행]" << std::endl;
                 Test_ProducerConsumer();
                 Test_HighContentionFalseSharing();
+                Test_PeekConsume();
+                Test_FramedProducerConsumer();
+                Test_BlockingWait();
                 break;
             case 8:
                 std::cout << "\n[전체 테스트 실행]" << std::endl;
@@ -943,6 +5663,66 @@ int main()
                 Test_BoundaryConditions();
                 Test_ProducerConsumer();
                 Test_HighContentionFalseSharing();
+                Test_PeekConsume();
+                Test_FramedProducerConsumer();
+                Test_BlockingWait();
+                break;
+            case 9:
+                Test_PeekConsume();
+                break;
+            case 10:
+                Test_MirroredStorage();
+                break;
+            case 11:
+                Test_FramedProducerConsumer();
+                break;
+            case 12:
+                Test_LockPolicyBenchmark();
+                break;
+            case 13:
+                Test_BlockingWait();
+                break;
+            case 14:
+                Test_Growable();
+                break;
+            case 15:
+                Test_SharedMemoryRing();
+                break;
+            case 16:
+                Test_JournalRing();
+                break;
+            case 17:
+                Test_RingQueue();
+                break;
+            case 18:
+                Test_FanIn();
+                break;
+            case 19:
+                Test_BroadcastRing();
+                break;
+            case 20:
+                Test_StreamingCopy();
+                break;
+            case 21:
+                Test_FixedSizePushPop();
+                break;
+            case 22:
+                Test_ChunkedStream();
+                break;
+            case 23:
+                Test_LatencyTrace();
+                break;
+            case 24:
+                Test_PriorityRing();
+                break;
+            case 25:
+                Test_ChecksumRecord();
+                break;
+            case 26:
+                Test_SocketIo();
+                break;
+            case 27:
+                Test_Coroutine();
                 break;
             default:
                 std::cout << "\n잘못된 선택입니다." << std::endl;
@@ -0,0 +1,417 @@
+//
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+#include <new>
+#include "RingBuffer.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+// Ͽ    - μ ׾ Sync  ڵ   ״ 
+//
+//  = [ (JOURNAL_HEADER_SIZE)][ ü][]
+//  SharedMemoryStorage ϹǷ Ͱ   ȿ ״  (Append ޸ 縸)
+//   Sync  б/ Ŀ  -  ü  Ŀ   
+//
+// Sync :   flush ->  Ŀ  ->   flush
+//  Ű  ׻ ̹ ũ ִ ̹Ƿ,   ׾   ϰ 
+// Sync  ̱  syncEveryBytes Ʈ Ǵ syncEveryMs иʸ   Ƽ flush
+//
+//  :
+//   - Sync  Append ڵ ũ  ǵ   (Sync  ڵ常 )
+//   - Sync  Read ڵ ũ  ٽ    (at-least-once)
+//     -> ڴ  б Ŀ  (ٽ   ִ )  .  ϸ  Sync
+//
+//   /  Һ: Append/Sync/SyncIfDue/Close  , Read Һ 忡 ȣ
+template<typename IndexPolicy = PowerOfTwoIndex>
+class CJournalRingT
+{
+public:
+    using RingType = CRingBufferT<SpscLock, IndexPolicy, SharedMemoryStorage>;
+    using Cursor = typename RingType::Cursor;
+
+    static constexpr size_t JOURNAL_HEADER_SIZE = 4096;
+
+    CJournalRingT()
+        : _view(nullptr)
+        , _viewSize(0)
+        , _ring(nullptr)
+        , _durableReadPos(0)
+        , _durableWritePos(0)
+        , _syncEveryBytes(0)
+        , _syncEveryMs(0)
+        , _pendingBytes(0)
+        , _recoveredSize(0)
+#if defined(_WIN32)
+        , _file(INVALID_HANDLE_VALUE)
+        , _mapping(nullptr)
+#elif defined(__linux__)
+        , _fd(-1)
+#endif
+    {
+    }
+
+    ~CJournalRingT()
+    {
+        Close();
+    }
+
+    CJournalRingT(const CJournalRingT&) = delete;
+    CJournalRingT& operator=(const CJournalRingT&) = delete;
+
+    //   ų  
+    //  ̸ capacity ũ ʱȭ,  ̸ Ͽ ϵ 뷮 ϰ  Sync · 
+    //  ٸų  Ŀ ջ ̸ 
+    bool Open(const char* path, size_t capacity, size_t syncEveryBytes = 64 * 1024, uint32_t syncEveryMs = 10)
+    {
+        if (_view != nullptr || path == nullptr)
+            return false;
+
+        bool created = false;
+        if (!MapFile(path, capacity, created))
+            return false;
+
+        Header* header = reinterpret_cast<Header*>(_view);
+
+        if (created)
+        {
+            header->magic = JOURNAL_MAGIC;
+            header->ringSize = static_cast<uint32_t>(sizeof(RingType));
+            header->capacity = capacity;
+            header->readPos = 0;
+            header->writePos = 0;
+            FlushRange(_view, JOURNAL_HEADER_SIZE);
+        }
+        else if (header->magic != JOURNAL_MAGIC
+            || header->ringSize != sizeof(RingType)
+            || !IndexPolicy::IsValidCapacity(static_cast<size_t>(header->capacity))
+            || _viewSize < JOURNAL_HEADER_SIZE + RingType::GetInPlaceSize(static_cast<size_t>(header->capacity)))
+        {
+            UnmapFile();
+            return false;
+        }
+
+        //  ü Ź  ϰ ( μ / ´ ȿ), Ŀ  
+        _ring = new (_view + JOURNAL_HEADER_SIZE) RingType(static_cast<size_t>(header->capacity));
+        if (!_ring->RestoreCursors(static_cast<Cursor>(header->readPos), static_cast<Cursor>(header->writePos)))
+        {
+            _ring->~RingType();
+            _ring = nullptr;
+            UnmapFile();
+            return false;
+        }
+
+        _durableReadPos = static_cast<Cursor>(header->readPos);
+        _durableWritePos = static_cast<Cursor>(header->writePos);
+        _syncEveryBytes = syncEveryBytes;
+        _syncEveryMs = syncEveryMs;
+        _pendingBytes = 0;
+        _lastSync = std::chrono::steady_clock::now();
+        _recoveredSize = _ring->GetDataSize();
+        return true;
+    }
+
+    //   Sync   
+    void Close()
+    {
+        if (_view == nullptr)
+            return;
+
+        Sync();
+        _ring->~RingType();
+        _ring = nullptr;
+        UnmapFile();
+    }
+
+    // ڵ ϳ .   size,   0 (All-or-Nothing)
+    //   Sync ֱⰡ Ǿ  ȣ ȿ flush
+    size_t Append(const void* data, size_t size)
+    {
+        if (_ring == nullptr)
+            return 0;
+
+        //  б Ŀ   ũ  ٽ   Ƿ   
+        // Һڰ ̹  ̶  ȭ ʾ Sync б Ŀ  
+        // EnqueueMessage ǽð б Ŀ Ƿ, ⼭  б Ŀ   Ȯ ξ 
+        Cursor writePos = _ring->GetWriteCursor();
+        size_t need = RingType::MESSAGE_HEADER_SIZE + size;
+        if (!FitsBeforeDurableRead(writePos, need))
+        {
+            if (_ring->GetReadCursor() == _durableReadPos)
+                return 0;
+
+            Sync();
+
+            // Sync  б Ŀ ķ Һڰ     Sync    
+            if (!FitsBeforeDurableRead(writePos, need))
+                return 0;
+        }
+
+        size_t written = _ring->EnqueueMessage(data, size);
+        if (written == 0)
+            return 0;
+
+        _pendingBytes += need;
+        SyncIfDue();
+        return written;
+    }
+
+    // ڵ ϳ .   ڵ ũ,  ְų size ڵ庸  0
+    size_t Read(void* data, size_t size)
+    {
+        if (_ring == nullptr)
+            return 0;
+
+        return _ring->DequeueMessage(data, size);
+    }
+
+    // ݱ /б⸦ ũ .  ȣ   ũô  · 
+    bool Sync()
+    {
+        if (_ring == nullptr)
+            return false;
+
+        // Ŀ   ΰ,   ͸ flush -> Ŀ    Sync 
+        Cursor writePos = _ring->GetWriteCursor();
+        Cursor readPos = _ring->GetReadCursor();
+
+        bool ok = FlushData(_durableWritePos, writePos);
+
+        Header* header = reinterpret_cast<Header*>(_view);
+        header->readPos = static_cast<uint64_t>(readPos);
+        header->writePos = static_cast<uint64_t>(writePos);
+        ok = FlushRange(_view, JOURNAL_HEADER_SIZE) && ok;
+
+        _durableReadPos = readPos;
+        _durableWritePos = writePos;
+        _pendingBytes = 0;
+        _lastSync = std::chrono::steady_clock::now();
+        return ok;
+    }
+
+    // Ʈ/ð   ϳ Ѿ Sync (ڰ Ѱ  ֱ ȣص )
+    bool SyncIfDue()
+    {
+        if (_ring == nullptr)
+            return false;
+
+        if (_pendingBytes >= _syncEveryBytes)
+            return Sync();
+
+        if (_pendingBytes == 0 && _ring->GetReadCursor() == _durableReadPos)
+            return true;
+
+        auto elapsed = std::chrono::steady_clock::now() - _lastSync;
+        if (std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() >= _syncEveryMs)
+            return Sync();
+
+        return true;
+    }
+
+    bool IsValid() const
+    {
+        return _ring != nullptr;
+    }
+
+    // Open   (  )  ũ - ޽  
+    size_t GetRecoveredSize() const
+    {
+        return _recoveredSize;
+    }
+
+    RingType* Get() const
+    {
+        return _ring;
+    }
+
+private:
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t ringSize;      // sizeof(RingType) - ø ڳ 尡 ٸ    
+        uint64_t capacity;
+        uint64_t readPos;       //  Sync  Ŀ
+        uint64_t writePos;
+    };
+
+    static_assert(sizeof(Header) <= JOURNAL_HEADER_SIZE, "    ŭ");
+
+    static constexpr uint32_t JOURNAL_MAGIC = 0x4C4E524A; // "JRNL"
+
+    //  : writePos need Ʈ ᵵ  б Ŀ(_durableReadPos)    ʴ
+    // _durableReadPos   Sync ٲǷ, Ȯ  EnqueueMessage ״ 
+    bool FitsBeforeDurableRead(Cursor writePos, size_t need) const
+    {
+        size_t capacity = _ring->GetCapacity();
+        return IndexPolicy::Distance(writePos, _durableReadPos, capacity) + need <= IndexPolicy::UsableSize(capacity);
+    }
+
+    // [from, to)   flush - wrap Ǹ   
+    bool FlushData(Cursor from, Cursor to)
+    {
+        size_t capacity = _ring->GetCapacity();
+        size_t size = IndexPolicy::Distance(to, from, capacity);
+        if (size == 0)
+            return true;
+
+        char* data = _view + JOURNAL_HEADER_SIZE + RingType::GetInPlaceSize(0);
+        size_t offset = IndexPolicy::Offset(from, capacity);
+        size_t firstSize = (std::min)(size, capacity - offset);
+
+        bool ok = FlushRange(data + offset, firstSize);
+        if (firstSize < size)
+            ok = FlushRange(data, size - firstSize) && ok;
+        return ok;
+    }
+
+#if defined(_WIN32)
+    bool MapFile(const char* path, size_t capacity, bool& created)
+    {
+        _file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize = {};
+        GetFileSizeEx(_file, &fileSize);
+
+        created = (fileSize.QuadPart == 0);
+        if (created)
+        {
+            if (!IndexPolicy::IsValidCapacity(capacity))
+            {
+                CloseHandle(_file);
+                _file = INVALID_HANDLE_VALUE;
+                return false;
+            }
+            fileSize.QuadPart = static_cast<LONGLONG>(JOURNAL_HEADER_SIZE + RingType::GetInPlaceSize(capacity));
+        }
+
+        //  ũ⸦ ϸ    ũ þ (þ κ 0)
+        _mapping = CreateFileMappingA(_file, nullptr, PAGE_READWRITE, fileSize.HighPart, fileSize.LowPart, nullptr);
+        if (_mapping != nullptr)
+            _view = static_cast<char*>(MapViewOfFile(_mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+
+        if (_view == nullptr)
+        {
+            UnmapFile();
+            return false;
+        }
+
+        _viewSize = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void UnmapFile()
+    {
+        if (_view != nullptr)
+            UnmapViewOfFile(_view);
+        if (_mapping != nullptr)
+            CloseHandle(_mapping);
+        if (_file != INVALID_HANDLE_VALUE)
+            CloseHandle(_file);
+
+        _view = nullptr;
+        _viewSize = 0;
+        _mapping = nullptr;
+        _file = INVALID_HANDLE_VALUE;
+    }
+
+    //  Ƽ  Ϸ    ü ũ flush
+    bool FlushRange(char* address, size_t size)
+    {
+        if (!FlushViewOfFile(address, size))
+            return false;
+        return FlushFileBuffers(_file) != FALSE;
+    }
+#elif defined(__linux__)
+    bool MapFile(const char* path, size_t capacity, bool& created)
+    {
+        _fd = open(path, O_RDWR | O_CREAT, 0600);
+        if (_fd < 0)
+            return false;
+
+        struct stat st = {};
+        if (fstat(_fd, &st) != 0)
+        {
+            UnmapFile();
+            return false;
+        }
+
+        size_t size = static_cast<size_t>(st.st_size);
+        created = (size == 0);
+        if (created)
+        {
+            size = JOURNAL_HEADER_SIZE + RingType::GetInPlaceSize(capacity);
+            if (!IndexPolicy::IsValidCapacity(capacity) || ftruncate(_fd, static_cast<off_t>(size)) != 0)
+            {
+                UnmapFile();
+                return false;
+            }
+        }
+
+        void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+        if (view == MAP_FAILED)
+        {
+            UnmapFile();
+            return false;
+        }
+
+        _view = static_cast<char*>(view);
+        _viewSize = size;
+        return true;
+    }
+
+    void UnmapFile()
+    {
+        if (_view != nullptr)
+            munmap(_view, _viewSize);
+        if (_fd >= 0)
+            close(_fd);
+
+        _view = nullptr;
+        _viewSize = 0;
+        _fd = -1;
+    }
+
+    // msync  迡 ؾ  -  ּҸ   
+    bool FlushRange(char* address, size_t size)
+    {
+        static const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        uintptr_t begin = reinterpret_cast<uintptr_t>(address) & ~(pageSize - 1);
+        uintptr_t end = reinterpret_cast<uintptr_t>(address) + size;
+        return msync(reinterpret_cast<void*>(begin), end - begin, MS_SYNC) == 0;
+    }
+#else
+    bool MapFile(const char* /*path*/, size_t /*capacity*/, bool& /*created*/) { return false; }
+    void UnmapFile() {}
+    bool FlushRange(char* /*address*/, size_t /*size*/) { return false; }
+#endif
+
+private:
+    char* _view;
+    size_t _viewSize;
+    RingType* _ring;
+
+    //   
+    Cursor _durableReadPos;     //  ϵ Ŀ
+    Cursor _durableWritePos;
+    size_t _syncEveryBytes;
+    uint32_t _syncEveryMs;
+    size_t _pendingBytes;       //  Sync  Append Ʈ (޽  )
+    std::chrono::steady_clock::time_point _lastSync;
+    size_t _recoveredSize;
+
+#if defined(_WIN32)
+    HANDLE _file;
+    HANDLE _mapping;
+#elif defined(__linux__)
+    int _fd;
+#endif
+};
+
+// === Type Aliases ( Ǽ) ===
+using CJournalRing = CJournalRingT<PowerOfTwoIndex>;
@@ -0,0 +1,237 @@
+//
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <new>
+#include "RingBuffer.h"
+
+// DequeueNext    
+enum class PriorityDrainMode
+{
+    Strict,         //      ȣ    (0 = ֿ켱) -        ٸ
+    Weighted,       // ġ  κ - θ weight ư  ( ε ġ ŭ )
+};
+
+//   -  ȣ  켱 (0  )
+struct PriorityLaneConfig
+{
+    size_t capacity;    //   뷮 (2 )
+    uint32_t weight;    // Weighted 忡  ʿ  ִ ޽  (0̸ 1 )
+};
+
+//   켱  -  Ŷ(α//GM ) 뷮 ̵ Ŷ ڿ  ʵ κ и
+// θ  CRingBufferT(޽ API) ΰ,     Ʈũ ϳ(_nonEmptyMask) ǥ
+// Һڴ ũ   о    ʰ    (    б 1 )
+//
+// ũ Ģ: ڴ   Ʈ Ѱ, Һڴ    Ʈ   ٽ Ȯؼ
+//  ̿  ޽  Ʈ ǻ츲 -> Ʈ  ä ޽  찡 
+//
+// Enqueue   忡 (  ڳ LockPolicy ȭ, SpscLock̸ δ  1)
+// DequeueNext/  ȸ  Һ 忡 ȣ
+// TracePolicy LatencyTrace ָ κ  ð ׷ GetLaneTrace(lane) 
+template<typename LockPolicy = MutexLock, typename TracePolicy = NoLatencyTrace>
+class CPriorityRingT
+{
+public:
+    using LaneRing = CRingBufferT<LockPolicy, PowerOfTwoIndex, HeapStorage, PlainCopy, TracePolicy>;
+
+    static constexpr int MAX_LANES = 64;
+
+    CPriorityRingT(const PriorityLaneConfig* lanes, int laneCount, PriorityDrainMode mode = PriorityDrainMode::Strict)
+        : _laneCount(0)
+        , _mode(mode)
+        , _nonEmptyMask(0)
+        , _currentLane(MAX_LANES - 1)   // ù ʴ  0
+        , _credit(0)
+    {
+        if (lanes == nullptr || laneCount <= 0 || laneCount > MAX_LANES)
+            return;
+
+        _lanes.reset(new (std::nothrow) std::unique_ptr<LaneRing>[laneCount]);
+        _weights.reset(new (std::nothrow) uint32_t[laneCount]);
+        if (!_lanes || !_weights)
+            return;
+
+        for (int i = 0; i < laneCount; i++)
+        {
+            _lanes[i].reset(new (std::nothrow) LaneRing(lanes[i].capacity));
+            if (!_lanes[i] || !_lanes[i]->IsValid())
+                return;
+            _weights[i] = lanes[i].weight > 0 ? lanes[i].weight : 1;
+        }
+
+        _laneCount = laneCount;
+    }
+
+    CPriorityRingT(const CPriorityRingT&) = delete;
+    CPriorityRingT& operator=(const CPriorityRingT&) = delete;
+
+    bool IsValid() const
+    {
+        return _laneCount > 0;
+    }
+
+    // ===   ===
+
+    // lane ޽ ϳ .   size,   áų lane   0 (All-or-Nothing)
+    size_t Enqueue(int lane, const void* data, size_t size)
+    {
+        if (lane < 0 || lane >= _laneCount)
+            return 0;
+
+        size_t written = _lanes[lane]->EnqueueMessage(data, size);
+        if (written == 0)
+            return 0;
+
+        // Ʈ ̹     (ڳ ũ ĳ   ʵ)
+        // seq_cst 潺: (Ŀ  -> Ʈ Ȯ) Һ (Ʈ  ->  Ȯ) ¹,    ݵ 븦 
+        uint64_t bit = LaneBit(lane);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if ((_nonEmptyMask.load(std::memory_order_relaxed) & bit) == 0)
+            _nonEmptyMask.fetch_or(bit, std::memory_order_acq_rel);
+
+        return written;
+    }
+
+    // === Һ  ===
+
+    // 巹 Ŀ   ޽ ϳ data .    ũ,    0
+    // size      0 (޽ ܵ - DequeueMessage  Ģ)
+    // outLane   ȣ
+    size_t DequeueNext(void* data, size_t size, int* outLane = nullptr)
+    {
+        if (data == nullptr || size == 0)
+            return 0;
+
+        // Ʈ  ִµ   (ǻ츰 Ʈ ) Ʈ ϰ ٽ  -  ŭ õ
+        for (int attempt = 0; attempt <= _laneCount; attempt++)
+        {
+            uint64_t mask = _nonEmptyMask.load(std::memory_order_acquire);
+            if (mask == 0)
+                return 0;
+
+            int lane = SelectLane(mask);
+            size_t length = _lanes[lane]->DequeueMessage(data, size);
+
+            if (length == 0)
+            {
+                // ۰ ۾Ƽ   ״ ȯ (   )
+                if (_lanes[lane]->GetDataSize() != 0)
+                    return 0;
+
+                ClearLaneBit(lane);
+                _credit = 0;
+                continue;
+            }
+
+            if (_credit > 0)
+                _credit--;
+
+            if (_lanes[lane]->GetDataSize() == 0)
+                ClearLaneBit(lane);
+
+            if (outLane != nullptr)
+                *outLane = lane;
+            return length;
+        }
+
+        return 0;
+    }
+
+    //     Ʈ (Ʈ - ڰ ÿ  ̸ ٷ ٲ)
+    uint64_t GetNonEmptyMask() const
+    {
+        return _nonEmptyMask.load(std::memory_order_acquire);
+    }
+
+    bool IsEmpty() const
+    {
+        return GetNonEmptyMask() == 0;
+    }
+
+    int GetLaneCount() const
+    {
+        return _laneCount;
+    }
+
+    PriorityDrainMode GetDrainMode() const
+    {
+        return _mode;
+    }
+
+    // ο  Ʈ (޽  )
+    size_t GetLaneDataSize(int lane) const
+    {
+        if (lane < 0 || lane >= _laneCount)
+            return 0;
+        return _lanes[lane]->GetDataSize();
+    }
+
+    // lane   ƹ͵ ϵ   Ʈ̽ ȯ
+    const TracePolicy& GetLaneTrace(int lane) const
+    {
+        if (lane < 0 || lane >= _laneCount)
+        {
+            static const TracePolicy emptyTrace{};
+            return emptyTrace;
+        }
+        return _lanes[lane]->GetLatencyTrace();
+    }
+
+private:
+    static uint64_t LaneBit(int lane)
+    {
+        return uint64_t(1) << lane;
+    }
+
+    // Һ : mask   
+    int SelectLane(uint64_t mask)
+    {
+        if (_mode == PriorityDrainMode::Strict)
+            return std::countr_zero(mask);
+
+        // Weighted:  ο   ְ    , ƴϸ      Ѿ  ä
+        if (_credit > 0 && (mask & LaneBit(_currentLane)) != 0)
+            return _currentLane;
+
+        // _currentLane  κ ȯ ˻ -  Ʈ  ,  ó
+        int next = _currentLane + 1;
+        uint64_t upper = next < MAX_LANES ? mask & ~(LaneBit(next) - 1) : 0;
+        _currentLane = upper != 0 ? std::countr_zero(upper) : std::countr_zero(mask);
+        _credit = _weights[_currentLane];
+        return _currentLane;
+    }
+
+    // Һ :    Ʈ ,   ڰ  ǻ츲
+    // Enqueue 潺  潺     밡   :  潺  Ȯο ޽ ̰,
+    //  潺  ڰ  Ʈ   ٽ 
+    void ClearLaneBit(int lane)
+    {
+        uint64_t bit = LaneBit(lane);
+        _nonEmptyMask.fetch_and(~bit, std::memory_order_acq_rel);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (_lanes[lane]->GetDataSize() != 0)
+            _nonEmptyMask.fetch_or(bit, std::memory_order_acq_rel);
+    }
+
+private:
+    std::unique_ptr<std::unique_ptr<LaneRing>[]> _lanes;
+    std::unique_ptr<uint32_t[]> _weights;
+    int _laneCount;
+    PriorityDrainMode _mode;
+
+    // ڵ Ѱ Һڰ  Ʈũ - ٸ ʵ ĳ  
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint64_t> _nonEmptyMask;
+
+    // Һ  (Weighted )
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) int _currentLane;
+    uint32_t _credit;   // _currentLane ̹ ʿ    ִ ޽ 
+};
+
+// ===  Ÿ  ===
+using CPriorityRing = CPriorityRingT<MutexLock>;                            // θ  
+using CPriorityRingTraced = CPriorityRingT<MutexLock, LatencyTrace<>>;      // κ  ð ׷ 
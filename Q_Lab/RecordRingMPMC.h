@@ -0,0 +1,233 @@
+//
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <new>
+#include "RingBuffer.h"
+
+//   /  Һ(MPMC) lock-free   ڵ 
+//
+// ۸ ĳ  ũ  , ڵ ӵ    
+//   sequence Ŀ Ŀ   (Vyukov bounded MPMC ť    Ȯ)
+//   sequence == pos                : ġ pos    (  Һ Ϸ)
+//   sequence == pos + 1            : ġ pos ϴ ڵ尡 ĿԵ (ڵ ù Ը )
+//   sequence == pos + slotCount    : Һ Ϸ,   pos + slotCount   
+//
+// ڴ ʿ       Ŀ CAS   Ȯϰ,
+// ͸   ù  sequence release  ڵ ü   
+// Һڴ ĿԵ ڵ ù  Ȯ  б Ŀ CAS  ڵ ü 
+//
+// All-or-Nothing: Enqueue ڵ ü ų 0, Dequeue ڵ ϳ ü аų 0
+class CRecordRingMPMC
+{
+public:
+    static constexpr size_t SLOT_SIZE = RINGBUFFER_CACHE_LINE_SIZE;
+
+    explicit CRecordRingMPMC(size_t capacity = 65536)
+        : _slots(nullptr)
+        , _slotCount(0)
+        , _slotMask(0)
+        , _writePos(0)
+        , _readPos(0)
+    {
+        if (capacity < SLOT_SIZE)
+            return;
+
+        //   2  ø (ġ  ŷ)
+        // ּ 2:  1 Ŀ Ŀ pos + 1  ġ ' '  ̼Һ ڵ带 
+        size_t slotCount = 2;
+        while (slotCount < capacity / SLOT_SIZE)
+            slotCount <<= 1;
+
+        _slots = new (std::nothrow) Slot[slotCount];
+        if (_slots == nullptr)
+            return;
+
+        _slotCount = slotCount;
+        _slotMask = slotCount - 1;
+
+        for (size_t i = 0; i < _slotCount; i++)
+        {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~CRecordRingMPMC()
+    {
+        delete[] _slots;
+    }
+
+    CRecordRingMPMC(const CRecordRingMPMC&) = delete;
+    CRecordRingMPMC& operator=(const CRecordRingMPMC&) = delete;
+
+    bool IsValid() const
+    {
+        return _slots != nullptr;
+    }
+
+    // === Public API ===
+
+    // ڵ ϳ .   size,   0
+    size_t Enqueue(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0 || _slots == nullptr || size > GetMaxRecordSize())
+            return 0;
+
+        const size_t slotNeed = SlotsFor(size);
+        uint64_t pos = _writePos.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            // All-or-Nothing: ڵ尡     ־ 
+            bool allFree = true;
+            for (size_t i = 0; i < slotNeed; i++)
+            {
+                uint64_t expected = pos + i;
+                uint64_t sequence = _slots[expected & _slotMask].sequence.load(std::memory_order_acquire);
+                if (sequence == expected)
+                    continue;
+
+                allFree = false;
+
+                //   ڵ尡  Һ  ->  
+                if (static_cast<int64_t>(sequence - expected) < 0)
+                    return 0;
+
+                // ٸ ڰ  Ȯ -> ֽ Ŀ ٽ õ
+                break;
+            }
+
+            if (allFree)
+            {
+                if (_writePos.compare_exchange_weak(pos, pos + slotNeed, std::memory_order_relaxed))
+                    break;
+            }
+            else
+            {
+                pos = _writePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Ȯ Կ  ( 迭  wrap   Ƿ   )
+        const char* src = static_cast<const char*>(data);
+        size_t remain = size;
+        for (size_t i = 0; i < slotNeed; i++)
+        {
+            Slot& slot = _slots[(pos + i) & _slotMask];
+            size_t chunk = (std::min)(remain, PAYLOAD_SIZE);
+            std::memcpy(slot.payload, src, chunk);
+            src += chunk;
+            remain -= chunk;
+        }
+
+        // ù  Ŀ Ŀ  -   ڵ ü Һڿ 
+        Slot& head = _slots[pos & _slotMask];
+        head.length.store(static_cast<uint32_t>(size), std::memory_order_relaxed);
+        head.sequence.store(pos + 1, std::memory_order_release);
+
+        return size;
+    }
+
+    // ڵ ϳ .   ڵ ũ,  ְų size ڵ庸  0
+    size_t Dequeue(void* data, size_t size)
+    {
+        if (data == nullptr || size == 0 || _slots == nullptr)
+            return 0;
+
+        uint64_t pos = _readPos.load(std::memory_order_relaxed);
+        size_t length = 0;
+
+        while (true)
+        {
+            Slot& head = _slots[pos & _slotMask];
+            uint64_t sequence = head.sequence.load(std::memory_order_acquire);
+            int64_t diff = static_cast<int64_t>(sequence - (pos + 1));
+
+            //  ĿԵ ڵ尡  ->  
+            if (diff < 0)
+                return 0;
+
+            if (diff == 0)
+            {
+                length = head.length.load(std::memory_order_relaxed);
+
+                // All-or-Nothing: ڵ ü    ܵ
+                if (length > size)
+                    return 0;
+
+                if (_readPos.compare_exchange_weak(pos, pos + SlotsFor(length), std::memory_order_relaxed))
+                    break;
+            }
+            else
+            {
+                // ٸ Һڰ   -> ֽ Ŀ ٽ õ
+                pos = _readPos.load(std::memory_order_relaxed);
+            }
+        }
+
+        // ڵ      ȯ
+        const size_t slotNeed = SlotsFor(length);
+        char* dst = static_cast<char*>(data);
+        size_t remain = length;
+        for (size_t i = 0; i < slotNeed; i++)
+        {
+            Slot& slot = _slots[(pos + i) & _slotMask];
+            size_t chunk = (std::min)(remain, PAYLOAD_SIZE);
+            std::memcpy(dst, slot.payload, chunk);
+            dst += chunk;
+            remain -= chunk;
+        }
+
+        for (size_t i = 0; i < slotNeed; i++)
+        {
+            _slots[(pos + i) & _slotMask].sequence.store(pos + i + _slotCount, std::memory_order_release);
+        }
+
+        return length;
+    }
+
+    // Ƽ ȯ濡 Ʈ 
+    size_t GetUsedSlotCount() const
+    {
+        uint64_t writePos = _writePos.load(std::memory_order_acquire);
+        uint64_t readPos = _readPos.load(std::memory_order_acquire);
+        return writePos >= readPos ? static_cast<size_t>(writePos - readPos) : 0;
+    }
+
+    size_t GetSlotCount() const
+    {
+        return _slotCount;
+    }
+
+    // ڵ ϳ   ִ ִ ũ (  )
+    size_t GetMaxRecordSize() const
+    {
+        return _slotCount * PAYLOAD_SIZE;
+    }
+
+private:
+    //  = Ŀ Ŀ + ڵ (ù Ը ) + ,  ĳ 
+    struct alignas(SLOT_SIZE) Slot
+    {
+        std::atomic<uint64_t> sequence;
+        std::atomic<uint32_t> length;
+        char payload[SLOT_SIZE - sizeof(std::atomic<uint64_t>) - sizeof(std::atomic<uint32_t>)];
+    };
+
+    static constexpr size_t PAYLOAD_SIZE = sizeof(Slot::payload);
+
+    static size_t SlotsFor(size_t size)
+    {
+        return (size + PAYLOAD_SIZE - 1) / PAYLOAD_SIZE;
+    }
+
+private:
+    Slot* _slots;
+    size_t _slotCount;
+    size_t _slotMask;
+
+    // /Һ Ŀ  ٸ ĳ 
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint64_t> _writePos;
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint64_t> _readPos;
+};
@@ -3,8 +3,47 @@
 #include <cstdint>
 #include <cstring>
 #include <mutex>
+#include <atomic>
 #include <algorithm>
 #include <stdexcept>
+#include <thread>
+#include <chrono>
+#include <type_traits>
+#include <new>
+#include <utility>
+#include <bit>
+#include <coroutine>
+
+#if defined(_WIN32)
+#include <windows.h>
+#pragma comment(lib, "Synchronization.lib")
+#elif defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// ũ 0 å  (NoLatencyTrace ) - MSVC ǥ [[no_unique_address]] ϹǷ  öڸ 
+#if defined(_MSC_VER)
+#define RINGBUFFER_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define RINGBUFFER_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+// /Һ Ŀ  ٸ ĳ ο α  ũ
+constexpr size_t RINGBUFFER_CACHE_LINE_SIZE = 64;
+
+// EnqueueWait/DequeueWait ŸӾƿ -  
+constexpr uint32_t RINGBUFFER_WAIT_INFINITE = 0xFFFFFFFF;
 
 // ø ⺻ Ű(Default Template Argument)
 struct NoLock
@@ -20,197 +59,2710 @@ struct MutexLock
     void unlock() { _mutex.unlock(); }
 };
 
+//   /  Һ(SPSC)  -   wait-free 
+// Enqueue  忡, Dequeue/Peek/Consume/Clear ٸ  忡 ȣؾ 
+// Ŀ ȭ CRingBufferT  acquire/release   
+struct SpscLock
+{
+    void lock() {}
+    void unlock() {}
+};
+
+//    CPU Ʈ  (x86: pause,  : Ϸ 踮)
+// ۽   ڿ 纸ϰ,  Ż  ޸   Ƽ 
+inline void RingBufferCpuRelax()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// word expected    (Linux: futex, Windows: WaitOnAddress)
+//  (  / ŸӾƿ / ¥ )   - ȣڰ  ٽ Ȯ
+// processShared: word ٸ μ ϴ ޸𸮿  (SharedMemoryStorage )
+//   Linux  futex(FUTEX_WAIT/FUTEX_WAKE, PRIVATE ) ٸ μ ⸦ 
+//   WaitOnAddress/std::atomic::wait μ ȿ Ƿ   ÷ 1ms  ƿ ٽ Ȯ
+inline void RingBufferWaitOnAddress(std::atomic<uint32_t>& word, uint32_t expected, uint32_t timeoutMs, bool processShared = false)
+{
+#if defined(_WIN32)
+    if (processShared)
+    {
+        Sleep((std::min)(timeoutMs, 1u));
+        return;
+    }
+    WaitOnAddress(&word, &expected, sizeof(expected), timeoutMs);
+#elif defined(__linux__)
+    timespec timeout = {};
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000;
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), processShared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE, expected,
+        timeoutMs == RINGBUFFER_WAIT_INFINITE ? nullptr : &timeout, nullptr, 0);
+#else
+    if (timeoutMs == RINGBUFFER_WAIT_INFINITE && !processShared)
+        word.wait(expected, std::memory_order_relaxed);
+    else
+        std::this_thread::sleep_for(std::chrono::milliseconds((std::min)(timeoutMs, 1u)));
+#endif
+}
+
+inline void RingBufferWakeAll(std::atomic<uint32_t>& word, bool processShared = false)
+{
+#if defined(_WIN32)
+    (void)processShared;
+    WakeByAddressAll(&word);
+#elif defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), processShared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#else
+    (void)processShared;
+    word.notify_all();
+#endif
+}
+
+// TTAS ɶ - Ӱ  memcpy    ª  Ŀ   
+//  Ǯ  б( ) Ȯ ڿ exchange õ ĳ   ̰,
+//   pause Ƚ   ø ( )
+//  ѿ ϸ yield -   尡   CPU Ѱ
+struct SpinLock
+{
+    static constexpr uint32_t MAX_BACKOFF = 1024;
+
+    std::atomic<bool> _locked{ false };
+
+    void lock()
+    {
+        uint32_t backoff = 1;
+        while (_locked.exchange(true, std::memory_order_acquire))
+        {
+            while (_locked.load(std::memory_order_relaxed))
+            {
+                if (backoff < MAX_BACKOFF)
+                {
+                    for (uint32_t i = 0; i < backoff; i++)
+                        RingBufferCpuRelax();
+                    backoff <<= 1;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+    void unlock() { _locked.store(false, std::memory_order_release); }
+};
+
+// Ƽ  -    Ѱִ (FIFO) ɶ
+// ȣǥ(_next) ް ڱ (_serving)   , ռ    pause
+// pause  Ƚ SPIN_LIMIT  yield (ʰ ּ  纸)
+//  峪   尡 Ǹ  ΰ ٸǷ ھ  尡  Ҹ
+struct TicketLock
+{
+    static constexpr uint32_t SPIN_LIMIT = 1024;
+
+    std::atomic<uint32_t> _next{ 0 };
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint32_t> _serving{ 0 };
+
+    void lock()
+    {
+        const uint32_t ticket = _next.fetch_add(1, std::memory_order_relaxed);
+        uint32_t spins = 0;
+
+        while (true)
+        {
+            uint32_t serving = _serving.load(std::memory_order_acquire);
+            if (serving == ticket)
+                return;
+
+            if (spins < SPIN_LIMIT)
+            {
+                uint32_t waiters = ticket - serving;
+                for (uint32_t i = 0; i < waiters; i++)
+                    RingBufferCpuRelax();
+                spins += waiters;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void unlock()
+    {
+        //  常 ŰǷ fetch_add  load + store
+        _serving.store(_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+};
+
+//   - ª  ڿ   std::atomic::wait  (Linux: futex, Windows: WaitOnAddress)
+// _state: 0 = , 1 = ( ), 2 = (    )
+// ڰ  unlock exchange    notify(ý ) 
+struct AdaptiveLock
+{
+    static constexpr uint32_t SPIN_LIMIT = 128;
+
+    std::atomic<uint32_t> _state{ 0 };
+
+    void lock()
+    {
+        for (uint32_t spins = 0; spins < SPIN_LIMIT; spins++)
+        {
+            uint32_t expected = 0;
+            if (_state.load(std::memory_order_relaxed) == 0
+                && _state.compare_exchange_weak(expected, 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return;
+            RingBufferCpuRelax();
+        }
+
+        //   2 ǥ unlock 쵵 
+        while (_state.exchange(2, std::memory_order_acquire) != 0)
+        {
+            _state.wait(2, std::memory_order_relaxed);
+        }
+    }
+
+    void unlock()
+    {
+        if (_state.exchange(0, std::memory_order_release) == 2)
+            _state.notify_one();
+    }
+};
+
+//  ȹ Ƚ   å (ġũ/ϸ)
+// īʹ    ¿ ϹǷ  ȭ ʿ
+template<typename InnerLock>
+struct CountingLock
+{
+    InnerLock _inner;
+    uint64_t _acquireCount = 0;
+    void lock() { _inner.lock(); ++_acquireCount; }
+    void unlock() { _inner.unlock(); }
+};
+
+// ε å: Ŀ  İ   ġ   
+// ⺻  - Ŀ [0, capacity) , ⷯ , Full/Empty   1Ʈ  
+struct ModuloIndex
+{
+    using Cursor = size_t;
+
+    static bool IsValidCapacity(size_t capacity) { return capacity > 0; }
+    static size_t UsableSize(size_t capacity) { return capacity - 1; }
+    static Cursor Advance(Cursor pos, size_t size, size_t capacity) { return (pos + size) % capacity; }
+    static size_t Offset(Cursor pos, size_t /*capacity*/) { return pos; }
+
+    static size_t Distance(Cursor writePos, Cursor readPos, size_t capacity)
+    {
+        if (writePos >= readPos)
+            return writePos - readPos;
+        else
+            return capacity - readPos + writePos;
+    }
+};
+
+// 2  뷮  - Ŀ  ϴ 64Ʈ ī, ġ ŷ 
+//  , Ŀ ̷ Full/Empty ϹǷ 뷮 ü 
+// īͰ 2^64 wrap Ǿ ȣ  ̹Ƿ DataSize ״ Ȯ
+struct PowerOfTwoIndex
+{
+    using Cursor = uint64_t;
+
+    static bool IsValidCapacity(size_t capacity) { return capacity > 0 && (capacity & (capacity - 1)) == 0; }
+    static size_t UsableSize(size_t capacity) { return capacity; }
+    static Cursor Advance(Cursor pos, size_t size, size_t /*capacity*/) { return pos + size; }
+    static size_t Offset(Cursor pos, size_t capacity) { return static_cast<size_t>(pos & (capacity - 1)); }
+    static size_t Distance(Cursor writePos, Cursor readPos, size_t /*capacity*/) { return static_cast<size_t>(writePos - readPos); }
+};
+
+//  å:   ޸𸮸  Ҵϴ 
+// ⺻ - new char[]  Ҵ, wrap  簡 2 
+struct HeapStorage
+{
+    static constexpr bool IsMirrored = false;
+    static constexpr bool IsInPlace = false;
+
+    static size_t AdjustCapacity(size_t capacity) { return capacity; }
+    char* Allocate(size_t capacity) { return new (std::nothrow) char[capacity]; }
+    void Release(char* buffer, size_t /*capacity*/) { delete[] buffer; }
+};
+
+//  ޸ ̷ -     ּһ    
+// [buffer, buffer + capacity)  [buffer + capacity, buffer + 2 * capacity)   ޸̹Ƿ
+// capacity   б/Ⱑ wrap       
+// 뷮 (Windows: Ҵ ) ũ  ø,  ʴ OS Ҵ 
+struct MirroredStorage
+{
+    static constexpr bool IsMirrored = true;
+    static constexpr bool IsInPlace = false;
+
+    static size_t AdjustCapacity(size_t capacity)
+    {
+        size_t granularity = GetGranularity();
+        if (capacity == 0 || granularity == 0)
+            return capacity;
+        return (capacity + granularity - 1) / granularity * granularity;
+    }
+
+#if defined(_WIN32)
+    static size_t GetGranularity()
+    {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwAllocationGranularity;
+    }
+
+    char* Allocate(size_t capacity)
+    {
+        HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+            static_cast<DWORD>(static_cast<uint64_t>(capacity) >> 32), static_cast<DWORD>(capacity & 0xFFFFFFFF), nullptr);
+        if (mapping == nullptr)
+            return nullptr;
+
+        char* result = nullptr;
+
+        // 2 ũ  ּ  ã  ϰ  ڸ   
+        // ~ ̿ ٸ 尡 ּҸ  ٽ õ
+        for (int retry = 0; retry < 16 && result == nullptr; retry++)
+        {
+            char* base = static_cast<char*>(VirtualAlloc(nullptr, capacity * 2, MEM_RESERVE, PAGE_NOACCESS));
+            if (base == nullptr)
+                break;
+            VirtualFree(base, 0, MEM_RELEASE);
+
+            void* first = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, capacity, base);
+            void* second = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, capacity, base + capacity);
+            if (first == base && second == base + capacity)
+            {
+                result = base;
+                break;
+            }
+
+            if (first != nullptr)
+                UnmapViewOfFile(first);
+            if (second != nullptr)
+                UnmapViewOfFile(second);
+        }
+
+        // ε 䰡  ϹǷ ڵ ٷ ݾƵ 
+        CloseHandle(mapping);
+        return result;
+    }
+
+    void Release(char* buffer, size_t capacity)
+    {
+        UnmapViewOfFile(buffer);
+        UnmapViewOfFile(buffer + capacity);
+    }
+#elif defined(__linux__)
+    static size_t GetGranularity()
+    {
+        long pageSize = sysconf(_SC_PAGESIZE);
+        return pageSize > 0 ? static_cast<size_t>(pageSize) : 4096;
+    }
+
+    char* Allocate(size_t capacity)
+    {
+        int fd = memfd_create("CRingBufferT", MFD_CLOEXEC);
+        if (fd < 0)
+            return nullptr;
+
+        if (ftruncate(fd, static_cast<off_t>(capacity)) != 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        // 2 ũ ּ   Ȯ   memfd /ڿ MAP_FIXED 
+        void* reserved = mmap(nullptr, capacity * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved == MAP_FAILED)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        char* base = static_cast<char*>(reserved);
+        void* first = mmap(base, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+        void* second = mmap(base + capacity, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+
+        //  memfd ϹǷ fd ٷ ݾƵ 
+        close(fd);
+
+        if (first != base || second != base + capacity)
+        {
+            munmap(base, capacity * 2);
+            return nullptr;
+        }
+
+        return base;
+    }
+
+    void Release(char* buffer, size_t capacity)
+    {
+        munmap(buffer, capacity * 2);
+    }
+#else
+    static size_t GetGranularity() { return 0; }
+    char* Allocate(size_t /*capacity*/) { return nullptr; }
+    void Release(char* /*buffer*/, size_t /*capacity*/) {}
+#endif
+};
+
+//  ü ٷ ڿ ͸ δ  (μ   ޸𸮿)
+//  ּҸ ͷ  ʰ  ü ּ +   ϹǷ,
+//  ޸𸮸 μ ٸ ּҿ ص ״  (position-independent)
+//  ü GetInPlaceSize(capacity) ũ Ͽ placement new ؾ  (SharedMemoryRing.h )
+//    Ұ
+struct SharedMemoryStorage
+{
+    static constexpr bool IsMirrored = false;
+    static constexpr bool IsInPlace = true;
+
+    static size_t AdjustCapacity(size_t capacity) { return capacity; }
+    char* Allocate(size_t /*capacity*/) { return nullptr; }
+    void Release(char* /*buffer*/, size_t /*capacity*/) {}
+};
+
+//  å: ڰ  ͸     (Һ   ׻ memcpy)
+// ⺻ - memcpy
+struct PlainCopy
+{
+    static void CopyIn(void* dst, const void* src, size_t size) { std::memcpy(dst, src, size); }
+};
+
+// ð(non-temporal)    -   CPUID   Ǻ
+enum class RingBufferStreamLevel
+{
+    None,   // x86 ƴ -> ׻ memcpy
+    Sse2,   // 16Ʈ _mm_stream_si128
+    Avx2,   // 32Ʈ _mm256_stream_si256 (OS YMM ¸  )
+};
+
+inline RingBufferStreamLevel DetectRingBufferStreamLevel()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] >= 7)
+    {
+        int features[4] = {};
+        __cpuid(features, 1);
+        bool osxsave = (features[2] & (1 << 27)) != 0;
+        bool avx = (features[2] & (1 << 28)) != 0;
+
+        int extended[4] = {};
+        __cpuidex(extended, 7, 0);
+        bool avx2 = (extended[1] & (1 << 5)) != 0;
+
+        if (osxsave && avx && avx2 && (_xgetbv(0) & 0x6) == 0x6)
+            return RingBufferStreamLevel::Avx2;
+    }
+    return RingBufferStreamLevel::Sse2;
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return RingBufferStreamLevel::Avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return RingBufferStreamLevel::Sse2;
+    return RingBufferStreamLevel::None;
+#else
+    return RingBufferStreamLevel::None;
+#endif
+}
+
+inline RingBufferStreamLevel GetRingBufferStreamLevel()
+{
+    static const RingBufferStreamLevel s_level = DetectRingBufferStreamLevel();
+    return s_level;
+}
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+//  ĳÿ ø ʰ ޸𸮷 ٷ  (write-combining) -   ʴ /  memcpy
+// ȣڰ Ŀ   _mm_sfence() ؾ 
+inline void RingBufferStreamCopySse2(char* dst, const char* src, size_t size)
+{
+    size_t head = (std::min)(size, (16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15);
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    size -= head;
+
+    for (; size >= 64; size -= 64, dst += 64, src += 64)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48), d);
+    }
+
+    for (; size >= 16; size -= 16, dst += 16, src += 16)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    }
+
+    std::memcpy(dst, src, size);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("avx2")))
+#endif
+inline void RingBufferStreamCopyAvx2(char* dst, const char* src, size_t size)
+{
+    size_t head = (std::min)(size, (32 - (reinterpret_cast<uintptr_t>(dst) & 31)) & 31);
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    size -= head;
+
+    for (; size >= 128; size -= 128, dst += 128, src += 128)
+    {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 64));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dst), a);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + 32), b);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + 64), c);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + 96), d);
+    }
+
+    for (; size >= 32; size -= 32, dst += 32, src += 32)
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dst), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+    }
+
+    std::memcpy(dst, src, size);
+}
+#endif
+
+// Ʈ ⺻ Ӱ谪 - ̺ ū    Һڰ б  L1/L2 з ɼ ŭ
+//  ھ/ĳ  ٸǷ IntegrityTest ޴ 20   ø ڷ  
+constexpr size_t RINGBUFFER_STREAMING_THRESHOLD = 64 * 1024;
+
+// 뷮 Ͽ - Threshold Ʈ ̸̻ ð  ĳø Ű ʰ 
+// Ʈ  Ϲ    Ƿ sfence  ȯ ->  Ŀ release   
+// x86 ƴϰų Threshold ̸̸ memcpy
+template<size_t Threshold = RINGBUFFER_STREAMING_THRESHOLD>
+struct StreamingCopy
+{
+    static void CopyIn(void* dst, const void* src, size_t size)
+    {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+        if (size >= Threshold)
+        {
+            switch (GetRingBufferStreamLevel())
+            {
+            case RingBufferStreamLevel::Avx2:
+                RingBufferStreamCopyAvx2(static_cast<char*>(dst), static_cast<const char*>(src), size);
+                _mm_sfence();
+                return;
+            case RingBufferStreamLevel::Sse2:
+                RingBufferStreamCopySse2(static_cast<char*>(dst), static_cast<const char*>(src), size);
+                _mm_sfence();
+                return;
+            default:
+                break;
+            }
+        }
+#endif
+        std::memcpy(dst, src, size);
+    }
+};
+
+// === CRC32C (Castagnoli) ===
+// üũ ڵ API(EnqueueRecord/DequeueRecord) -   ȿ  н 
+// x86 SSE4.2 crc32 (8Ʈ),  Ʈ ̺ -   CPUID   Ǻ
+// *Update Լ   ߰ ް : ó ~0 ϰ  ~ ؼ  (RingBufferCrc32c )
+
+constexpr uint32_t RINGBUFFER_CRC32C_POLY = 0x82F63B78;  // ݻ(reflected) ׽
+
+struct RingBufferCrc32cTable
+{
+    uint32_t entries[256];
+
+    constexpr RingBufferCrc32cTable()
+        : entries()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++)
+                crc = (crc & 1) ? (crc >> 1) ^ RINGBUFFER_CRC32C_POLY : crc >> 1;
+            entries[i] = crc;
+        }
+    }
+};
+
+inline constexpr RingBufferCrc32cTable RINGBUFFER_CRC32C_TABLE{};
+
+inline uint32_t RingBufferCrc32cUpdateSoftware(uint32_t crc, const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++)
+        crc = RINGBUFFER_CRC32C_TABLE.entries[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+// dst ϸ鼭 src CRC 
+inline uint32_t RingBufferCopyCrc32cSoftware(void* dst, const void* src, size_t size, uint32_t crc)
+{
+    unsigned char* out = static_cast<unsigned char*>(dst);
+    const unsigned char* in = static_cast<const unsigned char*>(src);
+    for (size_t i = 0; i < size; i++)
+    {
+        out[i] = in[i];
+        crc = RINGBUFFER_CRC32C_TABLE.entries[(crc ^ in[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+inline bool DetectRingBufferHardwareCrc32c()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int features[4] = {};
+    __cpuid(features, 1);
+    return (features[2] & (1 << 20)) != 0;
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2");
+#else
+    return false;
+#endif
+}
+
+inline bool RingBufferHasHardwareCrc32c()
+{
+    static const bool s_hardware = DetectRingBufferHardwareCrc32c();
+    return s_hardware;
+}
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+// 8Ʈ(32Ʈ  4Ʈ) о crc32  ϰ    dst  (dst nullptr )
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("sse4.2")))
+#endif
+inline uint32_t RingBufferCopyCrc32cSse42(void* dst, const void* src, size_t size, uint32_t crc)
+{
+    char* out = static_cast<char*>(dst);
+    const char* in = static_cast<const char*>(src);
+
+#if defined(_M_X64) || defined(__x86_64__)
+    uint64_t crc64 = crc;
+    for (; size >= 8; size -= 8, in += 8)
+    {
+        uint64_t value;
+        std::memcpy(&value, in, 8);
+        crc64 = _mm_crc32_u64(crc64, value);
+        if (out != nullptr)
+        {
+            std::memcpy(out, &value, 8);
+            out += 8;
+        }
+    }
+    crc = static_cast<uint32_t>(crc64);
+#else
+    for (; size >= 4; size -= 4, in += 4)
+    {
+        uint32_t value;
+        std::memcpy(&value, in, 4);
+        crc = _mm_crc32_u32(crc, value);
+        if (out != nullptr)
+        {
+            std::memcpy(out, &value, 4);
+            out += 4;
+        }
+    }
+#endif
+
+    for (; size > 0; size--, in++)
+    {
+        crc = _mm_crc32_u8(crc, static_cast<unsigned char>(*in));
+        if (out != nullptr)
+            *out++ = *in;
+    }
+    return crc;
+}
+#endif
+
+inline uint32_t RingBufferCrc32cUpdate(uint32_t crc, const void* data, size_t size)
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    if (RingBufferHasHardwareCrc32c())
+        return RingBufferCopyCrc32cSse42(nullptr, data, size, crc);
+#endif
+    return RingBufferCrc32cUpdateSoftware(crc, data, size);
+}
+
+inline uint32_t RingBufferCopyCrc32cUpdate(void* dst, const void* src, size_t size, uint32_t crc)
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    if (RingBufferHasHardwareCrc32c())
+        return RingBufferCopyCrc32cSse42(dst, src, size, crc);
+#endif
+    return RingBufferCopyCrc32cSoftware(dst, src, size, crc);
+}
+
+// ϼ CRC32C  ("123456789" -> 0xE3069283)
+inline uint32_t RingBufferCrc32c(const void* data, size_t size)
+{
+    return ~RingBufferCrc32cUpdate(0xFFFFFFFF, data, size);
+}
+
+// ===  ð  å ===
+// Enqueue  Ÿӽ ,  ڵ  Ʈ ҺǴ (Dequeue/Consume/Pop/޽ API)
+// ̸  ׷  - ť ӹ ð(queueing delay) 
+// ⺻ NoLatencyTrace  ζ Լ̶ ȣ ° 
+
+// Ÿӽ - x86 TSC(rdtsc),  ܴ steady_clock 
+inline uint64_t RingBufferReadTimestamp()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+// Ÿӽ 1ƽ  - ó ȣ  steady_clock 20ms ؼ   
+inline double GetRingBufferNsPerTick()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    static const double nsPerTick = []()
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        uint64_t startTick = __rdtsc();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        uint64_t endTick = __rdtsc();
+        auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+        return endTick > startTick ? static_cast<double>(elapsedNs) / static_cast<double>(endTick - startTick) : 1.0;
+    }();
+    return nsPerTick;
+#else
+    return 1.0;
+#endif
+}
+
+// ׷  () -   ش Ŷ ̹Ƿ ִ 1/16(6.25%)ŭ ũ 
+struct RingLatencySnapshot
+{
+    uint64_t count;
+    uint64_t p50Ns;
+    uint64_t p99Ns;
+    uint64_t p999Ns;
+    uint64_t maxNs;
+};
+
+// α- ׷: 2 ŵ  16 յ  Ŷ (HdrHistogram ,   6.25% ̳)
+//     (Һ ,   ), б ƹ 忡 Ʈ  ʰ 
+// īʹ relaxed   - д    ݿǰų     
+class CRingLatencyHistogram
+{
+public:
+    static constexpr int SUB_BUCKET_BITS = 4;
+    static constexpr uint64_t SUB_BUCKET_COUNT = 1ull << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT = SUB_BUCKET_COUNT + (64 - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT;
+
+    void Record(uint64_t ticks)
+    {
+        std::atomic<uint64_t>& bucket = _buckets[BucketIndex(ticks)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (ticks > _maxTicks.load(std::memory_order_relaxed))
+            _maxTicks.store(ticks, std::memory_order_relaxed);
+    }
+
+    RingLatencySnapshot GetSnapshot() const
+    {
+        RingLatencySnapshot snapshot = {};
+        double nsPerTick = GetRingBufferNsPerTick();
+
+        // Ŷ    ΰ  հ   (д   ӵǾ ϰ)
+        uint64_t counts[BUCKET_COUNT];
+        uint64_t total = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++)
+        {
+            counts[i] = _buckets[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+
+        snapshot.count = total;
+        snapshot.maxNs = static_cast<uint64_t>(_maxTicks.load(std::memory_order_relaxed) * nsPerTick);
+        if (total == 0)
+            return snapshot;
+
+        snapshot.p50Ns = static_cast<uint64_t>(PercentileTicks(counts, total, 0.5) * nsPerTick);
+        snapshot.p99Ns = static_cast<uint64_t>(PercentileTicks(counts, total, 0.99) * nsPerTick);
+        snapshot.p999Ns = static_cast<uint64_t>(PercentileTicks(counts, total, 0.999) * nsPerTick);
+
+        // Ŷ   ִ밪  ʵ
+        snapshot.p50Ns = (std::min)(snapshot.p50Ns, snapshot.maxNs);
+        snapshot.p99Ns = (std::min)(snapshot.p99Ns, snapshot.maxNs);
+        snapshot.p999Ns = (std::min)(snapshot.p999Ns, snapshot.maxNs);
+        return snapshot;
+    }
+
+    static size_t BucketIndex(uint64_t value)
+    {
+        if (value < SUB_BUCKET_COUNT)
+            return static_cast<size_t>(value);
+
+        int exponent = static_cast<int>(std::bit_width(value)) - 1;   // SUB_BUCKET_BITS ̻
+        int shift = exponent - SUB_BUCKET_BITS;
+        uint64_t subBucket = (value >> shift) & (SUB_BUCKET_COUNT - 1);
+        return static_cast<size_t>(SUB_BUCKET_COUNT + shift * SUB_BUCKET_COUNT + subBucket);
+    }
+
+    // index Ŷ   ū 
+    static uint64_t BucketUpperBound(size_t index)
+    {
+        if (index < SUB_BUCKET_COUNT)
+            return index;
+
+        size_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+        uint64_t subBucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+        uint64_t lower = (SUB_BUCKET_COUNT + subBucket) << shift;
+        return lower + ((1ull << shift) - 1);
+    }
+
+private:
+    static double PercentileTicks(const uint64_t* counts, uint64_t total, double percentile)
+    {
+        uint64_t rank = static_cast<uint64_t>(percentile * static_cast<double>(total));
+        if (rank >= total)
+            rank = total - 1;
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++)
+        {
+            seen += counts[i];
+            if (seen > rank)
+                return static_cast<double>(BucketUpperBound(i));
+        }
+        return static_cast<double>(BucketUpperBound(BUCKET_COUNT - 1));
+    }
+
+private:
+    std::atomic<uint64_t> _buckets[BUCKET_COUNT] = {};
+    std::atomic<uint64_t> _maxTicks{ 0 };
+};
+
+// ⺻ -   (   Լ)
+struct NoLatencyTrace
+{
+    static constexpr bool IsEnabled = false;
+
+    void OnEnqueue(size_t /*size*/) {}
+    void OnDequeue(size_t /*size*/) {}
+    void OnDiscard(size_t /*size*/) {}
+    void Reset() {}
+};
+
+// RINGBUFFER_NO_UNIQUE_ADDRESS  Ϸ  ũ 0  Ȯ (õǸ  е )
+struct RingBufferEmptyPolicyProbe
+{
+    uint64_t value;
+    RINGBUFFER_NO_UNIQUE_ADDRESS NoLatencyTrace trace;
+};
+static_assert(sizeof(RingBufferEmptyPolicyProbe) == sizeof(uint64_t), " å  ũ⸦  (RINGBUFFER_NO_UNIQUE_ADDRESS Ȯ)");
+
+// ڵ庰  ð 
+// ڴ (  Ʈ = ڵ , Ÿӽ)  FIFO ְ Ŀ  ( ͺ  )
+// Һڴ  Һ Ʈ ڵ     ׷  - Ʈ/޽/Push API   
+// FIFO  (StampCapacity ̻ ڵ尡 з )  ڵ   (GetDroppedStamps)
+//  ڵ   ٸ ̹Ƿ    - StampCapacity * SampleEvery  ÿ   ִ ڵ  ̻
+// SampleEvery: N ڵ帶 1  (Ÿӽ б  ū  ӽ    1/N)
+//  /Һ  ʵ带  ξǷ SpscLock   
+template<size_t StampCapacity = 1024, uint32_t SampleEvery = 1>
+struct LatencyTrace
+{
+    static_assert(StampCapacity > 0 && (StampCapacity & (StampCapacity - 1)) == 0, "StampCapacity 2 ̾ ");
+    static_assert(SampleEvery > 0 && (SampleEvery & (SampleEvery - 1)) == 0, "SampleEvery 2 ̾ ");
+
+    static constexpr bool IsEnabled = true;
+    static constexpr uint32_t SAMPLE_EVERY = SampleEvery;
+
+    //  : ڵ 1   (Ŀ  ) ȣ
+    void OnEnqueue(size_t size)
+    {
+        _enqueuedBytes += size;
+
+        if ((_recordCount++ & (SampleEvery - 1)) != 0)
+            return;
+
+        uint64_t tail = _stampTail.load(std::memory_order_relaxed);
+        if (tail - _stampHead.load(std::memory_order_acquire) >= StampCapacity)
+        {
+            _droppedStamps.store(_droppedStamps.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+
+        Stamp& stamp = _stamps[tail & (StampCapacity - 1)];
+        stamp.endBytes = _enqueuedBytes;
+        stamp.timestamp = RingBufferReadTimestamp();
+        _stampTail.store(tail + 1, std::memory_order_release);
+    }
+
+    // Һ : size Ʈ Һ  ȣ -  Һ ڵ  ð 
+    void OnDequeue(size_t size)
+    {
+        Retire(size, true);
+    }
+
+    // Һ :   (Clear) -  ϰ  
+    void OnDiscard(size_t size)
+    {
+        Retire(size, false);
+    }
+
+    // Ŀ ǵ  (/Һڰ  ʴ ) -  ʹ  
+    void Reset()
+    {
+        _enqueuedBytes = 0;
+        _recordCount = 0;
+        _dequeuedBytes = 0;
+        _stampHead.store(0, std::memory_order_relaxed);
+        _stampTail.store(0, std::memory_order_relaxed);
+    }
+
+    RingLatencySnapshot GetSnapshot() const
+    {
+        return _histogram.GetSnapshot();
+    }
+
+    uint64_t GetDroppedStamps() const
+    {
+        return _droppedStamps.load(std::memory_order_relaxed);
+    }
+
+private:
+    void Retire(size_t size, bool record)
+    {
+        _dequeuedBytes += size;
+
+        uint64_t head = _stampHead.load(std::memory_order_relaxed);
+        uint64_t tail = _stampTail.load(std::memory_order_acquire);
+
+        // Ÿӽ  ڵ尡      (ǥ   κ Dequeue  )
+        uint64_t now = 0;
+        uint64_t retired = head;
+        while (retired != tail)
+        {
+            const Stamp& stamp = _stamps[retired & (StampCapacity - 1)];
+            if (stamp.endBytes > _dequeuedBytes)
+                break;
+
+            if (record)
+            {
+                if (now == 0)
+                    now = RingBufferReadTimestamp();
+                _histogram.Record(now > stamp.timestamp ? now - stamp.timestamp : 0);
+            }
+            retired++;
+        }
+
+        if (retired != head)
+            _stampHead.store(retired, std::memory_order_release);
+    }
+
+private:
+    struct Stamp
+    {
+        uint64_t endBytes;      // ڵ  Ʈ   Ʈ 
+        uint64_t timestamp;
+    };
+
+    //  ĳ 
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint64_t> _stampTail{ 0 };
+    uint64_t _enqueuedBytes = 0;
+    uint64_t _recordCount = 0;
+    std::atomic<uint64_t> _droppedStamps{ 0 };
+
+    // Һ ĳ 
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint64_t> _stampHead{ 0 };
+    uint64_t _dequeuedBytes = 0;
+
+    Stamp _stamps[StampCapacity];
+    CRingLatencyHistogram _histogram;
+};
+
+// iovec ȣȯ (, ) 
+struct RingIoVec
+{
+    void* iov_base;
+    size_t iov_len;
+};
+
+//   θ  Ű ִ 2   (wrap  ҵ)
+struct RingSpans
+{
+    RingIoVec vec[2];
+    int count;          // ȿ   (0 ~ 2)
+    size_t totalSize;   //    
+};
+
+
+// === ڷƾ  (CRingBufferT::AsyncEnqueue/AsyncDequeue) ===
+// ⿡ ִ ۾  -   ϰ  ť  next  (    Ƿ Ҵ )
+struct RingAsyncTask
+{
+    RingAsyncTask* next;
+    void (*run)(RingAsyncTask* task);
+};
+
+//  ڷƾ 簳  - Post  忡 ȣ  ־ ϰ,
+//  ۾ Post 尡 ƴ϶  (Current() ڽ  )  
+// (RingCoroutine.h CRingCoroutineExecutor )
+class CRingAsyncExecutor
+{
+public:
+    virtual void Post(RingAsyncTask* task) = 0;
+
+    //  忡    ( nullptr)
+    static CRingAsyncExecutor*& Current()
+    {
+        static thread_local CRingAsyncExecutor* s_current = nullptr;
+        return s_current;
+    }
+
+protected:
+    ~CRingAsyncExecutor() = default;
+};
+
+//     -   executor ѱ
+struct RingAsyncWaiter : RingAsyncTask
+{
+    CRingAsyncExecutor* executor;
+};
+
+//  å: ŷ API(EnqueueWait/DequeueWait) ڷƾ API(AsyncEnqueue/AsyncDequeue)  
+// ⺻ -  :  API   ,  /Һ   Ȯ(seq_cst 潺 +  ī б) Ͽ 
+struct NoWait
+{
+    static constexpr bool IsEnabled = false;
+};
+
+//   - /Һ񸶴 潺 1 +  ī Ȯ (ڰ  ý  )
+// ڰ  б⸸ ϾǷ /Һڰ  ĳ  ص  
+struct BlockingWait
+{
+    static constexpr bool IsEnabled = true;
+
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint32_t> _dataSignal{ 0 };   // DequeueWait  ּ
+    std::atomic<uint32_t> _dataWaiters{ 0 };
+    std::atomic<uint32_t> _spaceSignal{ 0 };  // EnqueueWait  ּ
+    std::atomic<uint32_t> _spaceWaiters{ 0 };
+
+    // ڷƾ   (AsyncEnqueue/AsyncDequeue) - īʹ Notify*Ready   Ȯ
+    // μ  ̹Ƿ  ޸  ׻   (Async API SharedMemoryStorage ź)
+    std::atomic<uint32_t> _asyncDataWaiters{ 0 };
+    std::atomic<uint32_t> _asyncSpaceWaiters{ 0 };
+    SpinLock _asyncLock;
+    RingAsyncWaiter* _asyncDataHead{ nullptr };
+    RingAsyncWaiter* _asyncSpaceHead{ nullptr };
+};
+
+template<typename LockPolicy = NoLock, typename IndexPolicy = ModuloIndex, typename StoragePolicy = HeapStorage, typename CopyPolicy = PlainCopy, typename TracePolicy = NoLatencyTrace, typename WaitPolicy = NoWait>
+class CRingBufferT
+{
+public:
+    using Cursor = typename IndexPolicy::Cursor;
+    using TracePolicyType = TracePolicy;
+
+    explicit CRingBufferT(size_t capacity = 65536)
+        : _buffer(nullptr)
+        , _capacity(StoragePolicy::AdjustCapacity(capacity))
+        , _initialCapacity(_capacity)
+        , _maxCapacity(0)
+        , _shrinkEnabled(false)
+        , _allocated(false)
+        , _writePos(0)
+        , _cachedReadPos(0)
+        , _reservedSize(0)
+        , _readPos(0)
+        , _cachedWritePos(0)
+        , _lowUsageCount(0)
+        , _readSequence(0)
+        , _recordErrors(0)
+    {
+        if (!IndexPolicy::IsValidCapacity(_capacity))
+            return;
+
+        // ڸ Ҵ ü  ޸𸮸 ڰ ̹ Ȯ 
+        if constexpr (StoragePolicy::IsInPlace)
+        {
+            _allocated = true;
+            return;
+        }
+
+        _buffer = _storage.Allocate(_capacity);
+        _allocated = (_buffer != nullptr);
+    }
+
+    ~CRingBufferT()
+    {
+        if (_buffer != nullptr)
+            _storage.Release(_buffer, _capacity);
+    }
+
+    CRingBufferT(const CRingBufferT&) = delete;
+    CRingBufferT& operator=(const CRingBufferT&) = delete;
+
+    bool IsValid() const
+    {
+        return _allocated;
+    }
+
+    // === Public API ===
+
+    size_t Enqueue(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0 || !_allocated)
+            return 0;
+
+        _lock.lock();
+
+        //  ġ ڸ ϹǷ relaxed 
+        Cursor writePos = _writePos.load(std::memory_order_relaxed);
+
+        // All-or-Nothing: ü ũ⸸ŭ    ( 忡 Ű  writePos )
+        if (!HasWritable(writePos, size))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        // ü  
+        CopyToRing(IndexPolicy::Offset(writePos, _capacity), data, size);
+        _trace.OnEnqueue(size);
+
+        // release:  Ͱ Һڿ  ̵ 
+        _writePos.store(IndexPolicy::Advance(writePos, size, _capacity), std::memory_order_release);
+
+        _lock.unlock();
+        NotifyDataReady();
+        return size;
+    }
+
+    //  ۸    /   Ŀ   (gather)
+    // All-or-Nothing: ü հ踸ŭ   ƹ͵  .   ü ũ ȯ
+    size_t EnqueueV(const RingIoVec* vec, int count)
+    {
+        if (vec == nullptr || count <= 0 || !_allocated)
+            return 0;
+
+        size_t totalSize = 0;
+        for (int i = 0; i < count; i++)
+        {
+            if (vec[i].iov_base == nullptr && vec[i].iov_len > 0)
+                return 0;
+            totalSize += vec[i].iov_len;
+        }
+
+        if (totalSize == 0)
+            return 0;
+
+        _lock.lock();
+
+        Cursor writePos = _writePos.load(std::memory_order_relaxed);
+
+        if (!HasWritable(writePos, totalSize))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        Cursor pos = writePos;
+        for (int i = 0; i < count; i++)
+        {
+            if (vec[i].iov_len == 0)
+                continue;
+            CopyToRing(IndexPolicy::Offset(pos, _capacity), vec[i].iov_base, vec[i].iov_len);
+            pos = IndexPolicy::Advance(pos, vec[i].iov_len, _capacity);
+        }
+        _trace.OnEnqueue(totalSize);
+
+        _writePos.store(pos, std::memory_order_release);
+
+        _lock.unlock();
+        NotifyDataReady();
+        return totalSize;
+    }
+
+    // 2ܰ  (1) - size Ʈ    ִ    ȯ
+    // All-or-Nothing:  ϸ count == 0    ȯ
+    // ϸ   ä ȯǹǷ  忡 ݵ CommitWrite() ȣؾ 
+    RingSpans ReserveWrite(size_t size)
+    {
+        RingSpans spans = {};
+        if (size == 0 || !_allocated)
+            return spans;
+
+        _lock.lock();
+
+        Cursor writePos = _writePos.load(std::memory_order_relaxed);
+
+        if (!HasWritable(writePos, size))
+        {
+            _lock.unlock();
+            return spans;
+        }
+
+        FillSpans(spans, IndexPolicy::Offset(writePos, _capacity), size);
+        _reservedSize = size;
+
+        //  CommitWrite() 
+        return spans;
+    }
+
+    // 2ܰ  (2) -   տ size Ʈ 
+    // size  ũ  (recv()   ä ), 0̸  
+    //  ũ⸦  ƹ͵  ʰ 0 ȯ
+    size_t CommitWrite(size_t size)
+    {
+        if (_reservedSize == 0)
+            return 0;
+
+        if (size > _reservedSize)
+            size = 0;
+
+        if (size > 0)
+        {
+            _trace.OnEnqueue(size);
+            Cursor writePos = _writePos.load(std::memory_order_relaxed);
+            _writePos.store(IndexPolicy::Advance(writePos, size, _capacity), std::memory_order_release);
+        }
+
+        _reservedSize = 0;
+        _lock.unlock();
+
+        if (size > 0)
+            NotifyDataReady();
+        return size;
+    }
+
+    size_t Dequeue(void* data, size_t size)
+    {
+        if (data == nullptr || size == 0 || !_allocated)
+            return 0;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+
+        // All-or-Nothing: û ũ⸸ŭ Ͱ  
+        if (!HasReadable(readPos, size))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        // ü б 
+        CopyFromRing(data, IndexPolicy::Offset(readPos, _capacity), size);
+        _trace.OnDequeue(size);
+
+        // release: б⸦ ģ ڿ ڰ  ϵ 
+        PublishReadPos(IndexPolicy::Advance(readPos, size, _capacity));
+        ShrinkIfIdle();
+
+        _lock.unlock();
+        NotifySpaceReady();
+        return size;
+    }
+
+    // ִ ŭ(ִ maxSize)     (scatter   ۷ ϰ )
+    // All-or-Nothing ƴ:  ũ ȯ,   0
+    size_t DequeueBatch(void* data, size_t maxSize)
+    {
+        if (data == nullptr || maxSize == 0 || !_allocated)
+            return 0;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+
+        // ĳõ  ġ maxSize ä    ֽ  
+        HasReadable(readPos, maxSize);
+        size_t size = (std::min)(maxSize, CalcDataSize(_cachedWritePos, readPos));
+        if (size == 0)
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        CopyFromRing(data, IndexPolicy::Offset(readPos, _capacity), size);
+        _trace.OnDequeue(size);
+
+        PublishReadPos(IndexPolicy::Advance(readPos, size, _capacity));
+        ShrinkIfIdle();
+
+        _lock.unlock();
+        NotifySpaceReady();
+        return size;
+    }
+
+    // mutable lock Ͽ const Լ ȭ 
+    size_t Peek(void* data, size_t size) const
+    {
+        if (data == nullptr || size == 0 || !_allocated)
+            return 0;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+
+        // All-or-Nothing: û ũ⸸ŭ Ͱ  
+        if (!HasReadable(readPos, size))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        // ü б 
+        CopyFromRing(data, IndexPolicy::Offset(readPos, _capacity), size);
+
+        _lock.unlock();
+        return size;
+    }
+
+    static constexpr int PEEK_CONSISTENT_RETRIES = 8;
+
+    //   Peek (seqlock ) - ͸/ 尡     ʰ   size Ʈ 
+    // _readSequence Һڰ б ġ ű  Ȧ - Ȧ ٷ ٽ õ
+    //   _readSequence  ¦ ׵ Һڰ б ġ ű ʾǷ (= ڰ  ڸ   Ƿ) ϰ 
+    // ٸ maxRetries ٽ õ,   size / Ͱ ڶų õ  ϸ 0 (All-or-Nothing)
+    //  忡 ȣ  (SpscLock /Һڰ ƴ 3 忡  )
+    //  忡 ġ ۰ ٲǷ ׻ 0
+    // :  ϴ õ ڰ   Ʈ    (  data  ٲ )
+    size_t TryPeekConsistent(void* data, size_t size, int maxRetries = PEEK_CONSISTENT_RETRIES) const
+    {
+        if (data == nullptr || size == 0 || !_allocated || _maxCapacity != 0 || size > IndexPolicy::UsableSize(_capacity))
+            return 0;
+
+        for (int attempt = 0; attempt <= maxRetries; attempt++)
+        {
+            uint64_t sequence = _readSequence.load(std::memory_order_acquire);
+            if ((sequence & 1) != 0)
+            {
+                RingBufferCpuRelax();
+                continue;
+            }
+
+            Cursor readPos = _readPos.load(std::memory_order_acquire);
+            Cursor writePos = _writePos.load(std::memory_order_acquire);
+
+            if (CalcDataSize(writePos, readPos) < size)
+            {
+                // б ġ ״ε ڶ   
+                if (_readSequence.load(std::memory_order_acquire) == sequence)
+                    return 0;
+                continue;
+            }
+
+            CopyFromRing(data, IndexPolicy::Offset(readPos, _capacity), size);
+
+            // 縦  ڿ  ٽ е (簡  Ȯ ڷ и ʰ)
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_readSequence.load(std::memory_order_relaxed) == sequence)
+                return size;
+
+            RingBufferCpuRelax();
+        }
+
+        return 0;
+    }
+
+    //  ũ  1  - Enqueue(&value, sizeof(T))  ũⰡ  Ÿ 
+    // /ũ ˻簡   sizeof(T)  memcpy( ̵) , wrap ĥ  2 
+    // Enqueue/Dequeue  Ʈ  ᵵ  ( Ʈ Ʈ)
+    template<typename T>
+    bool Push(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Push trivially copyable ŸԸ ");
+
+        if (!_allocated)
+            return false;
+
+        _lock.lock();
+
+        Cursor writePos = _writePos.load(std::memory_order_relaxed);
+
+        if (!HasWritable(writePos, sizeof(T)))
+        {
+            _lock.unlock();
+            return false;
+        }
+
+        CopyValueToRing(IndexPolicy::Offset(writePos, _capacity), value);
+        _trace.OnEnqueue(sizeof(T));
+
+        _writePos.store(IndexPolicy::Advance(writePos, sizeof(T), _capacity), std::memory_order_release);
+
+        _lock.unlock();
+        NotifyDataReady();
+        return true;
+    }
+
+    //  ũ  1 б - sizeof(T) Ʈ    
+    template<typename T>
+    bool Pop(T& out)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Pop trivially copyable ŸԸ ");
+
+        if (!_allocated)
+            return false;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+
+        if (!HasReadable(readPos, sizeof(T)))
+        {
+            _lock.unlock();
+            return false;
+        }
+
+        CopyValueFromRing(out, IndexPolicy::Offset(readPos, _capacity));
+        _trace.OnDequeue(sizeof(T));
+
+        PublishReadPos(IndexPolicy::Advance(readPos, sizeof(T), _capacity));
+        ShrinkIfIdle();
+
+        _lock.unlock();
+        NotifySpaceReady();
+        return true;
+    }
+
+    template<typename T>
+    bool Peek(T& out) const
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Peek trivially copyable ŸԸ ");
+
+        if (!_allocated)
+            return false;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+
+        if (!HasReadable(readPos, sizeof(T)))
+        {
+            _lock.unlock();
+            return false;
+        }
+
+        CopyValueFromRing(out, IndexPolicy::Offset(readPos, _capacity));
+
+        _lock.unlock();
+        return true;
+    }
+
+    //   ִ ü ͸   ִ 2  ȯ (writev/ļ ٷ )
+    // ó ŭ Consume(size) б ġ ű -  Consume  ȿ
+    // Һ  ȣ: Һڰ ̸ PeekSpans~Consume  ȣڰ ȭؾ 
+    RingSpans PeekSpans() const
+    {
+        RingSpans spans = {};
+        if (!_allocated)
+            return spans;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+        _cachedWritePos = _writePos.load(std::memory_order_acquire);
+
+        size_t dataSize = CalcDataSize(_cachedWritePos, readPos);
+        if (dataSize > 0)
+        {
+            FillSpans(spans, IndexPolicy::Offset(readPos, _capacity), dataSize);
+        }
+
+        _lock.unlock();
+        return spans;
+    }
+
+    size_t Consume(size_t size)
+    {
+        if (size == 0 || !_allocated)
+            return 0;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+
+        // All-or-Nothing: û ũ⸸ŭ Ͱ  
+        if (!HasReadable(readPos, size))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        _trace.OnDequeue(size);
+        PublishReadPos(IndexPolicy::Advance(readPos, size, _capacity));
+        ShrinkIfIdle();
+
+        _lock.unlock();
+        NotifySpaceReady();
+        return size;
+    }
+
+    // === ޽() API ===
+    // [uint32_t ][]  ,      /   Ŀ  ó
+    // ޽  ǹǷ Һڴ ݸ  ޽   
+    //   Ʈ API(Enqueue/Dequeue)    
+
+    static constexpr size_t MESSAGE_HEADER_SIZE = sizeof(uint32_t);
+
+    // All-or-Nothing:  +  ü    .    ũ ȯ
+    size_t EnqueueMessage(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0 || size > UINT32_MAX || !_allocated)
+            return 0;
+
+        _lock.lock();
+
+        Cursor writePos = _writePos.load(std::memory_order_relaxed);
+
+        if (!HasWritable(writePos, MESSAGE_HEADER_SIZE + size))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        uint32_t header = static_cast<uint32_t>(size);
+        Cursor bodyPos = IndexPolicy::Advance(writePos, MESSAGE_HEADER_SIZE, _capacity);
+        CopyToRing(IndexPolicy::Offset(writePos, _capacity), &header, MESSAGE_HEADER_SIZE);
+        CopyToRing(IndexPolicy::Offset(bodyPos, _capacity), data, size);
+        _trace.OnEnqueue(MESSAGE_HEADER_SIZE + size);
+
+        _writePos.store(IndexPolicy::Advance(bodyPos, size, _capacity), std::memory_order_release);
+
+        _lock.unlock();
+        NotifyDataReady();
+        return size;
+    }
+
+    // ޽ ϳ .    ũ,  ְų size   0 (޽ ܵ)
+    size_t DequeueMessage(void* data, size_t size)
+    {
+        if (data == nullptr || size == 0 || !_allocated)
+            return 0;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+        uint32_t length = 0;
+
+        if (!ReadMessageHeader(readPos, length) || length > size)
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        Cursor bodyPos = IndexPolicy::Advance(readPos, MESSAGE_HEADER_SIZE, _capacity);
+        CopyFromRing(data, IndexPolicy::Offset(bodyPos, _capacity), length);
+        _trace.OnDequeue(MESSAGE_HEADER_SIZE + length);
+
+        PublishReadPos(IndexPolicy::Advance(bodyPos, length, _capacity));
+        ShrinkIfIdle();
+
+        _lock.unlock();
+        NotifySpaceReady();
+        return length;
+    }
+
+    //  ޽    ִ 2  ȯ ( count == 0)
+    // ó  ConsumeMessage()  - PeekSpans  Һ  Ģ 
+    RingSpans PeekMessageSpan() const
+    {
+        RingSpans spans = {};
+        if (!_allocated)
+            return spans;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+        uint32_t length = 0;
+
+        if (ReadMessageHeader(readPos, length))
+        {
+            Cursor bodyPos = IndexPolicy::Advance(readPos, MESSAGE_HEADER_SIZE, _capacity);
+            FillSpans(spans, IndexPolicy::Offset(bodyPos, _capacity), length);
+        }
+
+        _lock.unlock();
+        return spans;
+    }
+
+    //  ޽ .    ũ, ޽  0
+    size_t ConsumeMessage()
+    {
+        if (!_allocated)
+            return 0;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+        uint32_t length = 0;
+
+        if (!ReadMessageHeader(readPos, length))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        _trace.OnDequeue(MESSAGE_HEADER_SIZE + length);
+        PublishReadPos(IndexPolicy::Advance(readPos, MESSAGE_HEADER_SIZE + length, _capacity));
+        ShrinkIfIdle();
+
+        _lock.unlock();
+        NotifySpaceReady();
+        return length;
+    }
+
+    // === üũ ڵ API ===
+    // [uint32_t ][uint32_t CRC32C( + )][]  - ޽ API ջ   
+    // CRC  ϴ   н ϰ (SSE4.2 crc32 ,  ̺),   ϸ鼭 
+    // /μ  (SharedMemoryStorage ) ޸ ջ    - ǵ   ƴ
+    //  ϸ ̵   Ƿ ׶  ͸    ġ(׻ ڵ ) ٽ 
+    //   Ʈ API/޽ API    ,   CopyPolicy  CRC  縦 
+
+    static constexpr size_t RECORD_HEADER_SIZE = sizeof(uint32_t) * 2;
+
+    // All-or-Nothing:  +  ü    .    ũ ȯ
+    size_t EnqueueRecord(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0 || size > UINT32_MAX || !_allocated)
+            return 0;
+
+        _lock.lock();
+
+        Cursor writePos = _writePos.load(std::memory_order_relaxed);
+
+        if (!HasWritable(writePos, RECORD_HEADER_SIZE + size))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        uint32_t header[2] = { static_cast<uint32_t>(size), 0 };
+        uint32_t crc = RingBufferCrc32cUpdate(0xFFFFFFFF, &header[0], sizeof(uint32_t));
+
+        Cursor bodyPos = IndexPolicy::Advance(writePos, RECORD_HEADER_SIZE, _capacity);
+        crc = CopyToRingCrc(IndexPolicy::Offset(bodyPos, _capacity), data, size, crc);
+        header[1] = ~crc;
+        CopyToRing(IndexPolicy::Offset(writePos, _capacity), header, RECORD_HEADER_SIZE);
+        _trace.OnEnqueue(RECORD_HEADER_SIZE + size);
+
+        _writePos.store(IndexPolicy::Advance(bodyPos, size, _capacity), std::memory_order_release);
+
+        _lock.unlock();
+        NotifyDataReady();
+        return size;
+    }
+
+    // ڵ ϳ а .    ũ
+    //  ְų size   0 (ڵ ܵ)
+    // ջ ϸ 0 -  ͸   GetRecordErrorCount() 1  (data    )
+    size_t DequeueRecord(void* data, size_t size)
+    {
+        if (data == nullptr || size == 0 || !_allocated)
+            return 0;
+
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+
+        if (!HasReadable(readPos, RECORD_HEADER_SIZE))
+        {
+            _lock.unlock();
+            return 0;
+        }
+
+        uint32_t header[2];
+        CopyFromRing(header, IndexPolicy::Offset(readPos, _capacity), RECORD_HEADER_SIZE);
+        uint32_t length = header[0];
+        Cursor bodyPos = IndexPolicy::Advance(readPos, RECORD_HEADER_SIZE, _capacity);
+        uint32_t crc = RingBufferCrc32cUpdate(0xFFFFFFFF, &header[0], sizeof(uint32_t));
+
+        // ڵ   Բ ǹǷ,  ̴µ  ڶ ̰ ջ 
+        bool valid = (length != 0 && HasReadable(readPos, RECORD_HEADER_SIZE + static_cast<size_t>(length)));
+
+        if (valid && length > size)
+        {
+            // ۰  : ջ     ʵ ڸ  ϰ ܵ
+            if (~RingCrc(IndexPolicy::Offset(bodyPos, _capacity), length, crc) == header[1])
+            {
+                _lock.unlock();
+                return 0;
+            }
+            valid = false;
+        }
+
+        if (valid)
+            valid = (~CopyFromRingCrc(data, IndexPolicy::Offset(bodyPos, _capacity), length, crc) == header[1]);
+
+        if (!valid)
+        {
+            DiscardCorruptRecords(readPos);
+            _lock.unlock();
+            NotifySpaceReady();
+            return 0;
+        }
+
+        _trace.OnDequeue(RECORD_HEADER_SIZE + length);
+        PublishReadPos(IndexPolicy::Advance(bodyPos, length, _capacity));
+        ShrinkIfIdle();
+
+        _lock.unlock();
+        NotifySpaceReady();
+        return length;
+    }
+
+    // DequeueRecord ջ  Ƚ ()
+    uint64_t GetRecordErrorCount() const
+    {
+        return _recordErrors.load(std::memory_order_relaxed);
+    }
+
+    // === ŷ API ===
+    // /Ͱ      ٸ (  õ  ھ ¿ )
+    //  ڰ ϵǾ   Ͼ, ڴ  /  Ȯ ڿ ϵǹǷ
+    // δ full -> non-full, empty -> non-empty ̿ ý  ߻ ( δ ý  )
+    // ŸӾƿ(ms) ȿ  ϸ 0, RINGBUFFER_WAIT_INFINITE   
+    // WaitPolicy = BlockingWait    (CRingBufferWaitMT )
+    //  ޸ (SharedMemoryStorage)  ּҸ μ   ٷǷ ٸ μ ڵ 
+
+    static constexpr int WAIT_SPIN_COUNT = 64;
+
+    // All-or-Nothing: size Ʈ     .   뷮 ũ  0
+    size_t EnqueueWait(const void* data, size_t size, uint32_t timeoutMs = RINGBUFFER_WAIT_INFINITE)
+    {
+        static_assert(WaitPolicy::IsEnabled, "EnqueueWait WaitPolicy = BlockingWait   ");
+
+        if (size > MaxUsableSize())
+            return 0;
+
+        return WaitUntil([&]() { return Enqueue(data, size); }, _wait._spaceSignal, _wait._spaceWaiters, timeoutMs);
+    }
+
+    // All-or-Nothing: size Ʈ   .   뷮 ũ  0
+    size_t DequeueWait(void* data, size_t size, uint32_t timeoutMs = RINGBUFFER_WAIT_INFINITE)
+    {
+        static_assert(WaitPolicy::IsEnabled, "DequeueWait WaitPolicy = BlockingWait   ");
+
+        if (size > MaxUsableSize())
+            return 0;
+
+        return WaitUntil([&]() { return Dequeue(data, size); }, _wait._dataSignal, _wait._dataWaiters, timeoutMs);
+    }
+
+    // === ڷƾ API ===
+    // co_await ring.AsyncDequeue(buf, n) / co_await ring.AsyncEnqueue(data, n) -  Dequeue/Enqueue  (All-or-Nothing)
+    // ٷ Ǹ  ʰ, /  ڷƾ ߰   Ͽ 
+    // ݴ Ŀ (Notify*Ready) ڸ  await  (CRingAsyncExecutor::Current()) ѱ,
+    // ⿡ ٽ õؼ ϸ 簳, ƴϸ ٽ  (¥  ڷƾ  )
+    //  (Current() nullptr) awaitϸ  ʰ EnqueueWait/DequeueWaitó 带  ٸ
+    // Ͱ nullptr̰ų ũⰡ 0 Ǵ   뷮 ũ  ʰ 0
+    //  Ģ Enqueue/Dequeue ,   ڷƾ ִ   ı  
+    // WaitPolicy = BlockingWait   
+    //   μ  ּ(ڷƾ , ) Ƿ  ޸/  (SharedMemoryStorage)  Ұ
+
+    template<bool IsEnqueue>
+    class AsyncAwaiter : public RingAsyncWaiter
+    {
+    public:
+        AsyncAwaiter(CRingBufferT& ring, void* data, size_t size)
+            : RingAsyncWaiter{ { nullptr, &AsyncAwaiter::Retry }, nullptr }
+            , _ring(ring)
+            , _data(data)
+            , _size(size)
+            , _result(0)
+        {
+        }
+
+        bool await_ready()
+        {
+            if (_data == nullptr || _size == 0 || !_ring._allocated || _size > _ring.MaxUsableSize())
+                return true;
+
+            _result = TryOnce();
+            return _result != 0;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            executor = CRingAsyncExecutor::Current();
+            if (executor == nullptr)
+            {
+                //  忡 ٷ 簳ϸ await_suspend   ڷƾ ٸ 忡   
+                if constexpr (IsEnqueue)
+                    _result = _ring.EnqueueWait(_data, _size);
+                else
+                    _result = _ring.DequeueWait(_data, _size);
+                return false;
+            }
+
+            _handle = handle;
+            return Arm();
+        }
+
+        size_t await_resume() const
+        {
+            return _result;
+        }
+
+    private:
+        size_t TryOnce()
+        {
+            if constexpr (IsEnqueue)
+                return _ring.Enqueue(_data, _size);
+            else
+                return _ring.Dequeue(_data, _size);
+        }
+
+        //  Ͽ   ٽ õ (  潺 Notify*Ready 潺 ¹ ⸦ ġ )
+        // true:  ä ⸦ ٸ / false: ٷ 簳
+        bool Arm()
+        {
+            _ring.AddAsyncWaiter(IsEnqueue, this);
+
+            _result = TryOnce();
+            if (_result == 0)
+                return true;
+
+            // ߴµ   ̹ Ͽ  ,  ѱ Retry _result  簳
+            return !_ring.RemoveAsyncWaiter(IsEnqueue, this);
+        }
+
+        // await  ⿡  (Post    ƿ; ǹǷ Arm ġ )
+        static void Retry(RingAsyncTask* task)
+        {
+            AsyncAwaiter* self = static_cast<AsyncAwaiter*>(task);
+            if (self->_result == 0)
+            {
+                self->_result = self->TryOnce();
+                if (self->_result == 0 && self->Arm())
+                    return;
+            }
+            self->_handle.resume();
+        }
+
+    private:
+        CRingBufferT& _ring;
+        void* _data;
+        size_t _size;
+        size_t _result;
+        std::coroutine_handle<> _handle;
+    };
+
+    AsyncAwaiter<false> AsyncDequeue(void* data, size_t size)
+    {
+        static_assert(WaitPolicy::IsEnabled, "AsyncDequeue WaitPolicy = BlockingWait   ");
+        static_assert(!StoragePolicy::IsInPlace, "AsyncDequeue μ   (SharedMemoryStorage)  Ұ");
+        return AsyncAwaiter<false>(*this, data, size);
+    }
+
+    // data б⸸  (Enqueue  Ÿ ϱ  const )
+    AsyncAwaiter<true> AsyncEnqueue(const void* data, size_t size)
+    {
+        static_assert(WaitPolicy::IsEnabled, "AsyncEnqueue WaitPolicy = BlockingWait   ");
+        static_assert(!StoragePolicy::IsInPlace, "AsyncEnqueue μ   (SharedMemoryStorage)  Ұ");
+        return AsyncAwaiter<true>(*this, const_cast<void*>(data), size);
+    }
+
+    // ===   (opt-in) ===
+    // ۰   Ȱȭϸ,  ڶ ⿡ maxCapacity 2辿 Ű ͸  ġ
+    // shrink Һ  뷮 1/4  ° SHRINK_AFTER_IDLE_OPS ̾    (  뷮 ̸δ  پ)
+    // ġ  ȿ ϾǷ SpscLock( )   , ٸ  ϱ  ȣ 
+    // : ġǸ   PeekSpans/PeekMessageSpan  ȿ -   ٸ 尡    
+
+    static constexpr size_t GROWTH_FACTOR = 2;
+    static constexpr uint32_t SHRINK_AFTER_IDLE_OPS = 4096;
+
+    bool EnableGrowth(size_t maxCapacity, bool shrink = false)
+    {
+        if constexpr (std::is_same<LockPolicy, SpscLock>::value)
+            return false;
+
+        _lock.lock();
+
+        maxCapacity = StoragePolicy::AdjustCapacity(maxCapacity);
+        if (!_allocated || StoragePolicy::IsInPlace || maxCapacity < _capacity || !IndexPolicy::IsValidCapacity(maxCapacity))
+        {
+            _lock.unlock();
+            return false;
+        }
+
+        _maxCapacity = maxCapacity;
+        _shrinkEnabled = shrink;
+        _lowUsageCount = 0;
+        _lock.unlock();
+        return true;
+    }
+
+    // б ġ  ġ Ű  ͸  (SPSC Һ  ȣ)
+    void Clear()
+    {
+        _lock.lock();
+
+        if (!_allocated)
+        {
+            _lock.unlock();
+            return;
+        }
+
+        _cachedWritePos = _writePos.load(std::memory_order_acquire);
+        _trace.OnDiscard(CalcDataSize(_cachedWritePos, _readPos.load(std::memory_order_relaxed)));
+        PublishReadPos(_cachedWritePos);
+        _lock.unlock();
+        NotifySpaceReady();
+    }
+
+    // ׽Ʈ:  ִ  Ŀ ۰  (64Ʈ ī wrap  )
+    // /Һڰ  ʴ ¿ ȣ 
+    bool SetCursorBase(Cursor base)
+    {
+        _lock.lock();
+
+        // ȭ Ŀ   (ⷯ 忡 base < capacity)
+        if (!_allocated || GetDataSize() != 0 || IndexPolicy::Advance(base, 0, _capacity) != base)
+        {
+            _lock.unlock();
+            return false;
+        }
+
+        _writePos.store(base, std::memory_order_relaxed);
+        _readPos.store(base, std::memory_order_relaxed);
+        _cachedReadPos = base;
+        _cachedWritePos = base;
+        _trace.Reset();
+        _lock.unlock();
+        return true;
+    }
+
+    // :   Ŀ ǵ - [readPos, writePos)  Ͱ ۿ ̹ ־  (JournalRing.h )
+    // /Һڰ  ʴ ¿ ȣ 
+    bool RestoreCursors(Cursor readPos, Cursor writePos)
+    {
+        _lock.lock();
+
+        if (!_allocated
+            || IndexPolicy::Advance(readPos, 0, _capacity) != readPos
+            || IndexPolicy::Advance(writePos, 0, _capacity) != writePos
+            || CalcDataSize(writePos, readPos) > IndexPolicy::UsableSize(_capacity))
+        {
+            _lock.unlock();
+            return false;
+        }
+
+        _writePos.store(writePos, std::memory_order_relaxed);
+        _readPos.store(readPos, std::memory_order_relaxed);
+        _cachedReadPos = readPos;
+        _cachedWritePos = writePos;
+        _trace.Reset();
+        _lock.unlock();
+        return true;
+    }
+
+    //  ð  å - LatencyTrace GetSnapshot() Ʈ  ʰ ׷ 
+    const TracePolicy& GetLatencyTrace() const
+    {
+        return _trace;
+    }
+
+    //  Ŀ  (ȭ/ܿ) - Ƽ忡   
+    Cursor GetReadCursor() const
+    {
+        return _readPos.load(std::memory_order_acquire);
+    }
+
+    Cursor GetWriteCursor() const
+    {
+        return _writePos.load(std::memory_order_acquire);
+    }
+
+    // Ƽ ȯ濡 ǹ̾
+    size_t GetDataSize() const
+    {
+        //   - Ƽ忡 Ʈ 
+        return CalcDataSize(_writePos.load(std::memory_order_acquire),
+                            _readPos.load(std::memory_order_acquire));
+    }
+
+    // Ƽ ȯ濡 ǹ̾
+    size_t GetFreeSize() const
+    {
+        size_t usableSize = IndexPolicy::UsableSize(_capacity);
+        size_t dataSize = GetDataSize();
+        if (dataSize >= usableSize)
+            return 0;
+        return usableSize - dataSize;
+    }
+
+    //  忡 뷮 ٲ  Ƿ   
+    size_t GetCapacity() const
+    {
+        _lock.lock();
+        size_t capacity = _capacity;
+        _lock.unlock();
+        return capacity;
+    }
+
+    // SharedMemoryStorage:  ü + Ϳ ʿ ޸ ũ (ʹ ü  ĳ  )
+    static constexpr size_t GetInPlaceSize(size_t capacity)
+    {
+        return InPlaceDataOffset() + capacity;
+    }
+
+    //  å ü ȸ (CountingLock  Ȯ )
+    const LockPolicy& GetLockPolicy() const
+    {
+        return _lock;
+    }
+
+protected:
+    // Һ  б ġ  (seqlock  ) - BeginReadPublish / StoreReadPos / EndReadPublish  ȣ
+    //  Ȧ ø  ġ ű ¦ ǵ: ű ġ   ں Ȧ  ׻ ռ,
+    // ¦   ڴ ű ġ  (  +  ġ    )
+    // Һڳ  ȭǾ Ƿ RMW  а 
+    //  ̿   Ļ Ŭ   ֵ protected (IntegrityTest seqlock  )
+    void BeginReadPublish()
+    {
+        _readSequence.store(_readSequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void StoreReadPos(Cursor readPos)
+    {
+        _readPos.store(readPos, std::memory_order_release);
+    }
+
+    void EndReadPublish()
+    {
+        _readSequence.store(_readSequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    void PublishReadPos(Cursor readPos)
+    {
+        BeginReadPublish();
+        StoreReadPos(readPos);
+        EndReadPublish();
+    }
+
+    size_t CalcDataSize(Cursor writePos, Cursor readPos) const
+    {
+        return IndexPolicy::Distance(writePos, readPos, _capacity);
+    }
+
+    size_t CalcFreeSize(Cursor writePos, Cursor readPos) const
+    {
+        return IndexPolicy::UsableSize(_capacity) - CalcDataSize(writePos, readPos);
+    }
+
+    //  : ĳõ б ġ  Ǵϰ,   Һ ĳ  
+    //  忡 ׷ ϸ ۸ Ű - Ŀ ġǹǷ writePos ؼ 
+    bool HasWritable(Cursor& writePos, size_t size)
+    {
+        if (CalcFreeSize(writePos, _cachedReadPos) >= size)
+            return true;
+
+        _cachedReadPos = _readPos.load(std::memory_order_acquire);
+        if (CalcFreeSize(writePos, _cachedReadPos) >= size)
+            return true;
+
+        if (_maxCapacity == 0 || !Grow(size))
+            return false;
+
+        writePos = _writePos.load(std::memory_order_relaxed);
+        return true;
+    }
+
+    //  ۿ ȣ :  尡 ƴϸ _capacity ٲ ʰ,    
+    size_t MaxUsableSize() const
+    {
+        return IndexPolicy::UsableSize(_maxCapacity != 0 ? _maxCapacity : _capacity);
+    }
+
+    //  ȿ ȣ: size Ʈ      GROWTH_FACTOR辿 Ű (maxCapacity )
+    bool Grow(size_t size)
+    {
+        size_t required = CalcDataSize(_writePos.load(std::memory_order_relaxed), _readPos.load(std::memory_order_relaxed)) + size;
+        if (required > IndexPolicy::UsableSize(_maxCapacity))
+            return false;
+
+        size_t newCapacity = _capacity;
+        while (IndexPolicy::UsableSize(newCapacity) < required)
+        {
+            newCapacity = (std::min)(newCapacity * GROWTH_FACTOR, _maxCapacity);
+        }
+
+        return Relocate(newCapacity);
+    }
 
-template<typename LockPolicy = NoLock>
-class CRingBufferT
-{
-public:
-    explicit CRingBufferT(size_t capacity = 65536)
-        : _capacity(capacity)
-        , _readPos(0)
-        , _writePos(0)
-        , _buffer(nullptr)
+    // Һ   ȿ ȣ: 뷮  ° ̾  
+    void ShrinkIfIdle()
     {
-        if (capacity <= 0)
+        if (!_shrinkEnabled || _capacity <= _initialCapacity)
+            return;
+
+        size_t dataSize = CalcDataSize(_writePos.load(std::memory_order_relaxed), _readPos.load(std::memory_order_relaxed));
+        if (dataSize > _capacity / 4)
+        {
+            _lowUsageCount = 0;
+            return;
+        }
+
+        if (++_lowUsageCount < SHRINK_AFTER_IDLE_OPS)
             return;
 
-        _buffer = new (std::nothrow) char[_capacity];
+        _lowUsageCount = 0;
+        Relocate((std::max)(_initialCapacity, _capacity / GROWTH_FACTOR));
     }
 
-    ~CRingBufferT()
+    //  ȿ ȣ: newCapacity ۸  Ҵϰ  ͸  պ  ű (relinearize)
+    // Ŀ 0 ٽ ϹǷ /Һڰ     å 
+    bool Relocate(size_t newCapacity)
     {
-        delete[] _buffer;
+        newCapacity = StoragePolicy::AdjustCapacity(newCapacity);
+        if (newCapacity == _capacity || !IndexPolicy::IsValidCapacity(newCapacity))
+            return false;
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+        size_t dataSize = CalcDataSize(_writePos.load(std::memory_order_relaxed), readPos);
+        if (dataSize > IndexPolicy::UsableSize(newCapacity))
+            return false;
+
+        char* newBuffer = _storage.Allocate(newCapacity);
+        if (newBuffer == nullptr)
+            return false;
+
+        CopyFromRing(newBuffer, IndexPolicy::Offset(readPos, _capacity), dataSize);
+        _storage.Release(_buffer, _capacity);
+
+        _buffer = newBuffer;
+        _capacity = newCapacity;
+
+        Cursor newWritePos = IndexPolicy::Advance(0, dataSize, newCapacity);
+        _readPos.store(0, std::memory_order_relaxed);
+        _writePos.store(newWritePos, std::memory_order_release);
+        _cachedReadPos = 0;
+        _cachedWritePos = newWritePos;
+        return true;
     }
 
-    CRingBufferT(const CRingBufferT&) = delete;
-    CRingBufferT& operator=(const CRingBufferT&) = delete;
+    static constexpr size_t InPlaceDataOffset()
+    {
+        return (sizeof(CRingBufferT) + RINGBUFFER_CACHE_LINE_SIZE - 1) / RINGBUFFER_CACHE_LINE_SIZE * RINGBUFFER_CACHE_LINE_SIZE;
+    }
 
-    bool IsValid() const
+    //   ּ - ڸ Ҵ ε ּҰ μ ٸǷ Ź this  
+    char* Buffer() const
     {
-        return _buffer != nullptr;
+        if constexpr (StoragePolicy::IsInPlace)
+            return const_cast<char*>(reinterpret_cast<const char*>(this)) + InPlaceDataOffset();
+        else
+            return _buffer;
     }
 
-    // === Public API ===
+    // offset size Ʈ   (wrap  2 ,   CopyPolicy)
+    void CopyToRing(size_t offset, const void* data, size_t size)
+    {
+        char* buffer = Buffer();
 
-    size_t Enqueue(const void* data, size_t size)
+        // ̷ Ҵ  °  wrap ϹǷ ׻   
+        if (StoragePolicy::IsMirrored)
+        {
+            CopyPolicy::CopyIn(buffer + offset, data, size);
+            return;
+        }
+
+        size_t firstWrite = (std::min)(size, _capacity - offset);
+        CopyPolicy::CopyIn(buffer + offset, data, firstWrite);
+
+        if (size > firstWrite)
+        {
+            size_t secondWrite = size - firstWrite;
+            CopyPolicy::CopyIn(buffer, static_cast<const char*>(data) + firstWrite, secondWrite);
+        }
+    }
+
+    // offset size Ʈ   (wrap  2 )
+    void CopyFromRing(void* data, size_t offset, size_t size) const
     {
-        if (data == nullptr || size == 0 || _buffer == nullptr)
-            return 0;
+        const char* buffer = Buffer();
 
-        _lock.lock();
+        if (StoragePolicy::IsMirrored)
+        {
+            std::memcpy(data, buffer + offset, size);
+            return;
+        }
 
-        size_t freeSize = GetFreeSize();
+        size_t firstRead = (std::min)(size, _capacity - offset);
+        std::memcpy(data, buffer + offset, firstRead);
 
-        // All-or-Nothing: ü ũ⸸ŭ   
-        if (freeSize < size)
+        if (size > firstRead)
         {
-            _lock.unlock();
-            return 0;
+            size_t secondRead = size - firstRead;
+            std::memcpy(static_cast<char*>(data) + firstRead, buffer, secondRead);
         }
+    }
 
-        // ü  
-        size_t firstWrite = (std::min)(size, _capacity - _writePos);
-        std::memcpy(_buffer + _writePos, data, firstWrite);
+    // Push : ũⰡ  memcpy ζ ̵ ٲ (Ʈ Ӱ谪 ξ Ƿ CopyPolicy ġ )
+    // wrap ġ 幮 쿡 Ϲ η  
+    template<typename T>
+    void CopyValueToRing(size_t offset, const T& value)
+    {
+        if (StoragePolicy::IsMirrored || _capacity - offset >= sizeof(T))
+        {
+            std::memcpy(Buffer() + offset, &value, sizeof(T));
+            return;
+        }
 
-        if (size > firstWrite)
+        CopyToRing(offset, &value, sizeof(T));
+    }
+
+    template<typename T>
+    void CopyValueFromRing(T& out, size_t offset) const
+    {
+        if (StoragePolicy::IsMirrored || _capacity - offset >= sizeof(T))
         {
-            size_t secondWrite = size - firstWrite;
-            std::memcpy(_buffer, static_cast<const char*>(data) + firstWrite, secondWrite);
+            std::memcpy(&out, Buffer() + offset, sizeof(T));
+            return;
         }
 
-        _writePos = (_writePos + size) % _capacity;
+        CopyFromRing(&out, offset, sizeof(T));
+    }
 
-        _lock.unlock();
-        return size;
+    // offset size Ʈ wrap   ִ 2  
+    // ̷ Ҵ ׻ 1  
+    void FillSpans(RingSpans& spans, size_t offset, size_t size) const
+    {
+        char* buffer = Buffer();
+        size_t first = StoragePolicy::IsMirrored ? size : (std::min)(size, _capacity - offset);
+        spans.vec[0].iov_base = buffer + offset;
+        spans.vec[0].iov_len = first;
+        spans.count = 1;
+
+        if (size > first)
+        {
+            spans.vec[1].iov_base = buffer;
+            spans.vec[1].iov_len = size - first;
+            spans.count = 2;
+        }
+
+        spans.totalSize = size;
     }
 
-    size_t Dequeue(void* data, size_t size)
+    // CopyToRing  CopyPolicy  CRC32C ϸ鼭  (wrap  2 )
+    uint32_t CopyToRingCrc(size_t offset, const void* data, size_t size, uint32_t crc)
+    {
+        char* buffer = Buffer();
+        size_t firstWrite = StoragePolicy::IsMirrored ? size : (std::min)(size, _capacity - offset);
+        crc = RingBufferCopyCrc32cUpdate(buffer + offset, data, firstWrite, crc);
+
+        if (size > firstWrite)
+            crc = RingBufferCopyCrc32cUpdate(buffer, static_cast<const char*>(data) + firstWrite, size - firstWrite, crc);
+        return crc;
+    }
+
+    // CopyFromRing  CRC32C ϸ鼭 
+    uint32_t CopyFromRingCrc(void* data, size_t offset, size_t size, uint32_t crc) const
+    {
+        const char* buffer = Buffer();
+        size_t firstRead = StoragePolicy::IsMirrored ? size : (std::min)(size, _capacity - offset);
+        crc = RingBufferCopyCrc32cUpdate(data, buffer + offset, firstRead, crc);
+
+        if (size > firstRead)
+            crc = RingBufferCopyCrc32cUpdate(static_cast<char*>(data) + firstRead, buffer, size - firstRead, crc);
+        return crc;
+    }
+
+    //   size Ʈ    CRC32C 
+    uint32_t RingCrc(size_t offset, size_t size, uint32_t crc) const
+    {
+        const char* buffer = Buffer();
+        size_t first = StoragePolicy::IsMirrored ? size : (std::min)(size, _capacity - offset);
+        crc = RingBufferCrc32cUpdate(crc, buffer + offset, first);
+
+        if (size > first)
+            crc = RingBufferCrc32cUpdate(crc, buffer, size - first);
+        return crc;
+    }
+
+    // Һ ,  ȿ ȣ: ջ ڵ Ĵ 踦   Ƿ   ġ  
+    void DiscardCorruptRecords(Cursor readPos)
+    {
+        _recordErrors.store(_recordErrors.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        _cachedWritePos = _writePos.load(std::memory_order_acquire);
+        _trace.OnDiscard(CalcDataSize(_cachedWritePos, readPos));
+        PublishReadPos(_cachedWritePos);
+    }
+
+    // Һ : readPos ޽    ̸ 
+    // ޽   Բ ǹǷ  ̸     
+    bool ReadMessageHeader(Cursor readPos, uint32_t& length) const
+    {
+        if (!HasReadable(readPos, MESSAGE_HEADER_SIZE))
+            return false;
+
+        CopyFromRing(&length, IndexPolicy::Offset(readPos, _capacity), MESSAGE_HEADER_SIZE);
+        return true;
+    }
+
+    // Һ : ĳõ  ġ  Ǵϰ,    ĳ  
+    bool HasReadable(Cursor readPos, size_t size) const
+    {
+        if (CalcDataSize(_cachedWritePos, readPos) >= size)
+            return true;
+
+        _cachedWritePos = _writePos.load(std::memory_order_acquire);
+        return CalcDataSize(_cachedWritePos, readPos) >= size;
+    }
+
+    // tryOnce  :  õ ->   -> Ȯ -> 
+    //   Ȯΰ Notify*Ready (Ŀ  ->  Ȯ) seq_cst 潺 ¹ ⸦ ġ 
+    // signal    о ιǷ,   Ⱑ ־ٸ WaitOnAddress ٷ ȯ
+    template<typename TryFunc>
+    size_t WaitUntil(TryFunc tryOnce, std::atomic<uint32_t>& signal, std::atomic<uint32_t>& waiters, uint32_t timeoutMs)
     {
-        if (data == nullptr || size == 0 || _buffer == nullptr)
+        if (!_allocated)
             return 0;
 
-        _lock.lock();
+        for (int spin = 0; spin < WAIT_SPIN_COUNT; spin++)
+        {
+            size_t result = tryOnce();
+            if (result > 0)
+                return result;
+            RingBufferCpuRelax();
+        }
 
-        size_t dataSize = GetDataSize();
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
 
-        // All-or-Nothing: û ũ⸸ŭ Ͱ  
-        if (dataSize < size)
+        while (true)
         {
-            _lock.unlock();
-            return 0;
+            uint32_t observed = signal.load(std::memory_order_acquire);
+
+            waiters.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            size_t result = tryOnce();
+            uint32_t remainMs = RINGBUFFER_WAIT_INFINITE;
+
+            if (result == 0 && timeoutMs != RINGBUFFER_WAIT_INFINITE)
+            {
+                auto now = std::chrono::steady_clock::now();
+                remainMs = now >= deadline ? 0 : static_cast<uint32_t>(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1);
+            }
+
+            if (result == 0 && remainMs > 0)
+                RingBufferWaitOnAddress(signal, observed, remainMs, StoragePolicy::IsInPlace);
+
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+
+            if (result > 0 || remainMs == 0)
+                return result;
         }
+    }
 
-        // ü б 
-        size_t firstRead = (std::min)(size, _capacity - _readPos);
-        std::memcpy(data, _buffer + _readPos, firstRead);
+    //  :  ġ   DequeueWait / AsyncDequeue ڰ    (NoWait  Լ)
+    void NotifyDataReady()
+    {
+        if constexpr (WaitPolicy::IsEnabled)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_wait._dataWaiters.load(std::memory_order_relaxed) != 0)
+            {
+                _wait._dataSignal.fetch_add(1, std::memory_order_release);
+                RingBufferWakeAll(_wait._dataSignal, StoragePolicy::IsInPlace);
+            }
+            if (_wait._asyncDataWaiters.load(std::memory_order_relaxed) != 0)
+                WakeAsyncWaiters(false);
+        }
+    }
 
-        if (size > firstRead)
+    // Һ : б ġ   EnqueueWait / AsyncEnqueue ڰ    (NoWait  Լ)
+    void NotifySpaceReady()
+    {
+        if constexpr (WaitPolicy::IsEnabled)
         {
-            size_t secondRead = size - firstRead;
-            std::memcpy(static_cast<char*>(data) + firstRead, _buffer, secondRead);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_wait._spaceWaiters.load(std::memory_order_relaxed) != 0)
+            {
+                _wait._spaceSignal.fetch_add(1, std::memory_order_release);
+                RingBufferWakeAll(_wait._spaceSignal, StoragePolicy::IsInPlace);
+            }
+            if (_wait._asyncSpaceWaiters.load(std::memory_order_relaxed) != 0)
+                WakeAsyncWaiters(true);
         }
+    }
 
-        _readPos = (_readPos + size) % _capacity;
+    // ڷƾ   - space: AsyncEnqueue( ), ƴϸ AsyncDequeue( )
+    void AddAsyncWaiter(bool space, RingAsyncWaiter* waiter)
+    {
+        _wait._asyncLock.lock();
+        RingAsyncWaiter*& head = space ? _wait._asyncSpaceHead : _wait._asyncDataHead;
+        waiter->next = head;
+        head = waiter;
+        (space ? _wait._asyncSpaceWaiters : _wait._asyncDataWaiters).fetch_add(1, std::memory_order_relaxed);
+        _wait._asyncLock.unlock();
 
-        _lock.unlock();
-        return size;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
     }
 
-    // mutable lock Ͽ const Լ ȭ 
-    size_t Peek(void* data, size_t size) const
+    //  Ͽ   true,   ̹   false
+    bool RemoveAsyncWaiter(bool space, RingAsyncWaiter* waiter)
     {
-        if (data == nullptr || size == 0 || _buffer == nullptr)
-            return 0;
+        _wait._asyncLock.lock();
+        RingAsyncWaiter** link = space ? &_wait._asyncSpaceHead : &_wait._asyncDataHead;
+        while (*link != nullptr && *link != waiter)
+            link = reinterpret_cast<RingAsyncWaiter**>(&(*link)->next);
+
+        bool found = (*link == waiter);
+        if (found)
+        {
+            *link = static_cast<RingAsyncWaiter*>(waiter->next);
+            (space ? _wait._asyncSpaceWaiters : _wait._asyncDataWaiters).fetch_sub(1, std::memory_order_relaxed);
+        }
+        _wait._asyncLock.unlock();
+        return found;
+    }
+
+    //  °    ⿡ ѱ (ѱ ڿ 带 ǵ帮  - 簳Ǹ   )
+    void WakeAsyncWaiters(bool space)
+    {
+        _wait._asyncLock.lock();
+        RingAsyncWaiter*& head = space ? _wait._asyncSpaceHead : _wait._asyncDataHead;
+        RingAsyncWaiter* list = head;
+        head = nullptr;
+        (space ? _wait._asyncSpaceWaiters : _wait._asyncDataWaiters).store(0, std::memory_order_relaxed);
+        _wait._asyncLock.unlock();
+
+        //  տ ٿǷ   ٸ ʺ
+        RingAsyncWaiter* ordered = nullptr;
+        while (list != nullptr)
+        {
+            RingAsyncWaiter* next = static_cast<RingAsyncWaiter*>(list->next);
+            list->next = ordered;
+            ordered = list;
+            list = next;
+        }
+
+        while (ordered != nullptr)
+        {
+            RingAsyncWaiter* next = static_cast<RingAsyncWaiter*>(ordered->next);
+            ordered->next = nullptr;
+            ordered->executor->Post(ordered);
+            ordered = next;
+        }
+    }
+
+private:
+    char* _buffer;              // SharedMemoryStorage   (Buffer() )
+    size_t _capacity;
+    size_t _initialCapacity;    //  忡 پ  ִ 
+    size_t _maxCapacity;        // 0̸   
+    bool _shrinkEnabled;
+    bool _allocated;            //   Һ -  忡 _buffer ٲ  ۿ ȿ Ȯ 
+    mutable LockPolicy _lock;  //  ø Ű!
+    StoragePolicy _storage;
+
+    //  ĳ :  ġ +  Ȯ б ġ
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<Cursor> _writePos;
+    Cursor _cachedReadPos;
+    size_t _reservedSize;   // ReserveWrite()  CommitWrite()   ũ
+
+    // Һ ĳ : б ġ +  Ȯ  ġ
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<Cursor> _readPos;
+    mutable Cursor _cachedWritePos;
+    uint32_t _lowUsageCount;    //  : 뷮  ·  Һ Ƚ
+    std::atomic<uint64_t> _readSequence;    // б ġ ű  Ȧ, ű  ¦ (TryPeekConsistent )
+    std::atomic<uint64_t> _recordErrors;    // DequeueRecord  ջ Ƚ
+
+    // ŷ/ڷƾ API /  (NoWait ũ 0)
+    RINGBUFFER_NO_UNIQUE_ADDRESS WaitPolicy _wait;
+
+    //  ð  (NoLatencyTrace ũ 0)
+    RINGBUFFER_NO_UNIQUE_ADDRESS TracePolicy _trace;
+};
+
+// === Type Aliases ( Ǽ) ===
+using CRingBufferST = CRingBufferT<NoLock>;       // ̱۽ 
+using CRingBufferMT = CRingBufferT<MutexLock>;    // Ƽ  (⺻)
+using CRingBufferSPSC = CRingBufferT<SpscLock>;   //  / Һ lock-free 
+
+// Ƽ  å  (Ӱ  ª  mutex  )
+using CRingBufferSpinMT = CRingBufferT<SpinLock>;          // TTAS ɶ
+using CRingBufferTicketMT = CRingBufferT<TicketLock>;      // (FIFO) Ƽ 
+using CRingBufferAdaptiveMT = CRingBufferT<AdaptiveLock>;  //   (park)
+
+// 2  뷮 + 64Ʈ Ŀ  ( , 뷮 ü )
+using CRingBufferPow2ST = CRingBufferT<NoLock, PowerOfTwoIndex>;
+using CRingBufferPow2MT = CRingBufferT<MutexLock, PowerOfTwoIndex>;
+using CRingBufferPow2SPSC = CRingBufferT<SpscLock, PowerOfTwoIndex>;
+
+//  ޸ ̷   (wrap    , ׻  )
+using CRingBufferMirrorST = CRingBufferT<NoLock, ModuloIndex, MirroredStorage>;
+using CRingBufferMirrorMT = CRingBufferT<MutexLock, ModuloIndex, MirroredStorage>;
+using CRingBufferMirrorSPSC = CRingBufferT<SpscLock, ModuloIndex, MirroredStorage>;
+
+// 뷮  Ʈ  (RINGBUFFER_STREAMING_THRESHOLD ̻ ð )
+using CRingBufferStreamMT = CRingBufferT<MutexLock, PowerOfTwoIndex, HeapStorage, StreamingCopy<>>;
+using CRingBufferStreamSPSC = CRingBufferT<SpscLock, PowerOfTwoIndex, HeapStorage, StreamingCopy<>>;
+
+//  ð   (Enqueue -> Dequeue  ð ׷, GetLatencyTrace().GetSnapshot())
+using CRingBufferTracedMT = CRingBufferT<MutexLock, ModuloIndex, HeapStorage, PlainCopy, LatencyTrace<>>;
+using CRingBufferTracedSPSC = CRingBufferT<SpscLock, PowerOfTwoIndex, HeapStorage, PlainCopy, LatencyTrace<>>;
+
+// ŷ/ڷƾ  API (EnqueueWait/DequeueWait, AsyncEnqueue/AsyncDequeue)  
+using CRingBufferWaitST = CRingBufferT<NoLock, ModuloIndex, HeapStorage, PlainCopy, NoLatencyTrace, BlockingWait>;
+using CRingBufferWaitMT = CRingBufferT<MutexLock, ModuloIndex, HeapStorage, PlainCopy, NoLatencyTrace, BlockingWait>;
+using CRingBufferWaitSPSC = CRingBufferT<SpscLock, ModuloIndex, HeapStorage, PlainCopy, NoLatencyTrace, BlockingWait>;
+
+//  뷮 Ÿ ť - CRingBufferT   
+// Ʈ  void* + ũ memcpy , ⼭ T Կ ״ /̵ϹǷ ũ ˻ Ʈ 簡 
+// Capacity 2  ø : ġ  Ÿ ũ, Ŀ PowerOfTwoIndex  64Ʈ ī (뷮 ü )
+//  ü ȿ Ƿ 뷮 ũ    (std::make_unique )
+//  å CRingBufferT  (SpscLock: Push  , Pop/Peek/TryPopBulk/Clear ٸ  忡 ȣ)
+template<typename T, size_t Capacity, typename LockPolicy = NoLock>
+class CRingQueueT
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity 2 ̾ ");
+
+public:
+    using Cursor = uint64_t;
 
+    CRingQueueT()
+        : _writePos(0)
+        , _cachedReadPos(0)
+        , _readPos(0)
+        , _cachedWritePos(0)
+    {
+    }
+
+    //  Ҹ  ı - ٸ 尡  ʴ ¿ Ҹų 
+    ~CRingQueueT()
+    {
+        DestroyRange(_readPos.load(std::memory_order_relaxed), _writePos.load(std::memory_order_relaxed));
+    }
+
+    CRingQueueT(const CRingQueueT&) = delete;
+    CRingQueueT& operator=(const CRingQueueT&) = delete;
+
+    // === Public API ===
+
+    bool Push(const T& value)
+    {
+        return Emplace(value);
+    }
+
+    bool Push(T&& value)
+    {
+        return Emplace(std::move(value));
+    }
+
+    // Կ T  .    false (ڴ  )
+    template<typename... Args>
+    bool Emplace(Args&&... args)
+    {
         _lock.lock();
 
-        size_t dataSize = GetDataSize();
+        Cursor writePos = _writePos.load(std::memory_order_relaxed);
+        if (!HasWritable(writePos))
+        {
+            _lock.unlock();
+            return false;
+        }
 
-        // All-or-Nothing: û ũ⸸ŭ Ͱ  
-        if (dataSize < size)
+        new (SlotBytes(writePos)) T(std::forward<Args>(args)...);
+
+        // release:  Ұ Һڿ  ̵ 
+        _writePos.store(writePos + 1, std::memory_order_release);
+
+        _lock.unlock();
+        return true;
+    }
+
+    //   Ҹ out ̵   Ҹ ı.   false
+    bool Pop(T& out)
+    {
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+        if (!HasReadable(readPos, 1))
         {
             _lock.unlock();
-            return 0;
+            return false;
         }
 
-        // ü б 
-        size_t firstPeek = (std::min)(size, _capacity - _readPos);
-        std::memcpy(data, _buffer + _readPos, firstPeek);
+        T* slot = Slot(readPos);
+        out = std::move(*slot);
+        slot->~T();
 
-        if (size > firstPeek)
+        // release: Ҹ   ڿ ڰ  ϵ 
+        _readPos.store(readPos + 1, std::memory_order_release);
+
+        _lock.unlock();
+        return true;
+    }
+
+    //   Ҹ  ( ).   false
+    bool Peek(T& out) const
+    {
+        _lock.lock();
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+        if (!HasReadable(readPos, 1))
         {
-            size_t secondPeek = size - firstPeek;
-            std::memcpy(static_cast<char*>(data) + firstPeek, _buffer, secondPeek);
+            _lock.unlock();
+            return false;
         }
 
+        out = *Slot(readPos);
+
         _lock.unlock();
-        return size;
+        return true;
     }
 
-    size_t Consume(size_t size)
+    // ִ ŭ(ִ maxCount)    /   Ŀ  .   ȯ,   0
+    // trivially copyable Ÿ wrap   ִ 2 memcpy,  ܴ Һ ̵ + ı
+    size_t TryPopBulk(T* out, size_t maxCount)
     {
-        if (size == 0 || _buffer == nullptr)
+        if (out == nullptr || maxCount == 0)
             return 0;
 
         _lock.lock();
 
-        size_t dataSize = GetDataSize();
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
 
-        // All-or-Nothing: û ũ⸸ŭ Ͱ  
-        if (dataSize < size)
+        // ĳõ  ġ maxCount ä    ֽ  
+        HasReadable(readPos, maxCount);
+        size_t count = (std::min)(maxCount, static_cast<size_t>(_cachedWritePos - readPos));
+        if (count == 0)
         {
             _lock.unlock();
             return 0;
         }
 
-        _readPos = (_readPos + size) % _capacity;
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            size_t offset = static_cast<size_t>(readPos & INDEX_MASK);
+            size_t first = (std::min)(count, Capacity - offset);
+            std::memcpy(out, SlotBytes(readPos), first * sizeof(T));
+            if (count > first)
+                std::memcpy(out + first, SlotBytes(0), (count - first) * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                T* slot = Slot(readPos + i);
+                out[i] = std::move(*slot);
+                slot->~T();
+            }
+        }
+
+        _readPos.store(readPos + count, std::memory_order_release);
 
         _lock.unlock();
-        return size;
+        return count;
     }
 
+    // Һ :  Ҹ  ıϰ 
     void Clear()
     {
         _lock.lock();
-        
-        if (_buffer == nullptr)
-        {
-            _lock.unlock();
-            return;
-        }
-        
-        _readPos = 0;
-        _writePos = 0;
+
+        Cursor readPos = _readPos.load(std::memory_order_relaxed);
+        Cursor writePos = _writePos.load(std::memory_order_acquire);
+        DestroyRange(readPos, writePos);
+        _cachedWritePos = writePos;
+        _readPos.store(writePos, std::memory_order_release);
+
         _lock.unlock();
     }
 
     // Ƽ ȯ濡 ǹ̾
-    size_t GetDataSize() const
+    size_t GetSize() const
     {
         //   - Ƽ忡 Ʈ 
-        if (_writePos >= _readPos)
-            return _writePos - _readPos;
-        else
-            return _capacity - _readPos + _writePos;
+        return static_cast<size_t>(_writePos.load(std::memory_order_acquire) - _readPos.load(std::memory_order_acquire));
     }
 
     // Ƽ ȯ濡 ǹ̾
     size_t GetFreeSize() const
     {
-        size_t dataSize = GetDataSize();
-        if (dataSize >= _capacity - 1)
-            return 0;
-        return _capacity - dataSize - 1;
+        return Capacity - GetSize();
+    }
+
+    static constexpr size_t GetCapacity()
+    {
+        return Capacity;
     }
 
 private:
-    char* _buffer;
-    size_t _capacity;
-    size_t _readPos;
-    size_t _writePos;
-    mutable LockPolicy _lock;  //  ø Ű!
-};
+    static constexpr Cursor INDEX_MASK = Capacity - 1;
 
-// === Type Aliases ( Ǽ) ===
-using CRingBufferST = CRingBufferT<NoLock>;       // ̱۽ 
-using CRingBufferMT = CRingBufferT<MutexLock>;    // Ƽ  (⺻)
\ No newline at end of file
+    struct alignas(T) SlotStorage
+    {
+        unsigned char bytes[sizeof(T)];
+    };
+
+    void* SlotBytes(Cursor pos) const
+    {
+        return const_cast<unsigned char*>(_slots[pos & INDEX_MASK].bytes);
+    }
+
+    T* Slot(Cursor pos) const
+    {
+        return std::launder(reinterpret_cast<T*>(SlotBytes(pos)));
+    }
+
+    void DestroyRange(Cursor from, Cursor to)
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            for (Cursor pos = from; pos != to; pos++)
+                Slot(pos)->~T();
+        }
+    }
+
+    //  : ĳõ б ġ  Ǵϰ,  á  Һ ĳ  
+    bool HasWritable(Cursor writePos)
+    {
+        if (writePos - _cachedReadPos < Capacity)
+            return true;
+
+        _cachedReadPos = _readPos.load(std::memory_order_acquire);
+        return writePos - _cachedReadPos < Capacity;
+    }
+
+    // Һ : ĳõ  ġ  Ǵϰ,    ĳ  
+    bool HasReadable(Cursor readPos, size_t count) const
+    {
+        if (_cachedWritePos - readPos >= count)
+            return true;
+
+        _cachedWritePos = _writePos.load(std::memory_order_acquire);
+        return _cachedWritePos - readPos >= count;
+    }
+
+private:
+    mutable LockPolicy _lock;
+
+    //  ĳ :  ġ +  Ȯ б ġ
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<Cursor> _writePos;
+    Cursor _cachedReadPos;
+
+    // Һ ĳ : б ġ +  Ȯ  ġ
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<Cursor> _readPos;
+    mutable Cursor _cachedWritePos;
+
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) SlotStorage _slots[Capacity];
+};
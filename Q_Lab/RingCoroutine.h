@@ -0,0 +1,229 @@
+//
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+#include "RingBuffer.h"
+
+// ⿡ ø ڷƾ (ȯ Ÿ) - co_await ring.AsyncDequeue(...)   Լ ȯ
+//   · ϰ CRingCoroutineExecutor::Spawn Ѱܾ  (ѱ ʰ  ı)
+//   ıǹǷ    -  ĸó  
+// ܴ  Ƿ ڷƾ ȿ ܰ  terminate
+class CRingTask
+{
+public:
+    struct promise_type : RingAsyncTask
+    {
+        size_t* liveTasks = nullptr;    //   ڷƾ  ( ,  忡 )
+
+        CRingTask get_return_object()
+        {
+            return CRingTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            if (liveTasks != nullptr)
+                (*liveTasks)--;
+            return {};
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+
+        //  ť ó   
+        static void Start(RingAsyncTask* task)
+        {
+            std::coroutine_handle<promise_type>::from_promise(*static_cast<promise_type*>(task)).resume();
+        }
+    };
+
+    CRingTask(CRingTask&& other) noexcept
+        : _handle(std::exchange(other._handle, nullptr))
+    {
+    }
+
+    CRingTask(const CRingTask&) = delete;
+    CRingTask& operator=(const CRingTask&) = delete;
+    CRingTask& operator=(CRingTask&&) = delete;
+
+    ~CRingTask()
+    {
+        if (_handle)
+            _handle.destroy();
+    }
+
+private:
+    friend class CRingCoroutineExecutor;
+
+    explicit CRingTask(std::coroutine_handle<promise_type> handle)
+        : _handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> _handle;
+};
+
+//   ڷƾ  - Run() θ  ϳ Spawn ڷƾ   ڷƾ ʷ 簳
+//   Post(  ڷƾ  ڷƾ )    ť, ٸ  Post ؽ ť +  
+//  ڷƾ  Run() ȯ (   ٸ  Post ٸ )
+// Spawn Run()  Ǵ Run()   (ڷƾ ) ȣ
+//   ڷƾ   Ͽ    Ƿ Ⱑ ı  - Run() ȯ    
+class CRingCoroutineExecutor : public CRingAsyncExecutor
+{
+public:
+    CRingCoroutineExecutor() = default;
+    CRingCoroutineExecutor(const CRingCoroutineExecutor&) = delete;
+    CRingCoroutineExecutor& operator=(const CRingCoroutineExecutor&) = delete;
+
+    void Spawn(CRingTask task)
+    {
+        CRingTask::promise_type& promise = task._handle.promise();
+        promise.liveTasks = &_liveTasks;
+        promise.next = nullptr;
+        promise.run = &CRingTask::promise_type::Start;
+        task._handle = nullptr;     //  Ⱑ  ( final_suspend  ı)
+
+        _liveTasks++;
+        PushLocal(&promise);
+    }
+
+    void Post(RingAsyncTask* task) override
+    {
+        task->next = nullptr;
+        if (CRingAsyncExecutor::Current() == this)
+        {
+            PushLocal(task);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_remoteMutex);
+            if (_remoteTail != nullptr)
+                _remoteTail->next = task;
+            else
+                _remoteHead = task;
+            _remoteTail = task;
+            _remotePending.store(true, std::memory_order_release);
+        }
+        _remoteCv.notify_one();
+    }
+
+    //  ڷƾ   
+    void Run()
+    {
+        CRingAsyncExecutor*& current = CRingAsyncExecutor::Current();
+        CRingAsyncExecutor* previous = current;
+        current = this;
+
+        while (_liveTasks > 0)
+        {
+            if (_remotePending.load(std::memory_order_acquire))
+                DrainRemote(false);
+
+            RingAsyncTask* task = PopLocal();
+            if (task == nullptr)
+            {
+                DrainRemote(true);
+                continue;
+            }
+
+            _runCount++;
+            task->run(task);
+        }
+
+        current = previous;
+    }
+
+    // ݱ  ۾  (Spawn  +    õ/簳)
+    uint64_t GetRunCount() const
+    {
+        return _runCount;
+    }
+
+    // ٸ 忡 Post  ۾ 
+    uint64_t GetRemotePostCount() const
+    {
+        return _remotePosts;
+    }
+
+private:
+    void PushLocal(RingAsyncTask* task)
+    {
+        if (_localTail != nullptr)
+            _localTail->next = task;
+        else
+            _localHead = task;
+        _localTail = task;
+    }
+
+    RingAsyncTask* PopLocal()
+    {
+        RingAsyncTask* task = _localHead;
+        if (task != nullptr)
+        {
+            _localHead = task->next;
+            if (_localHead == nullptr)
+                _localTail = nullptr;
+            task->next = nullptr;
+        }
+        return task;
+    }
+
+    //  ť °  ť ڿ  - wait      
+    void DrainRemote(bool wait)
+    {
+        std::unique_lock<std::mutex> lock(_remoteMutex);
+        if (wait)
+            _remoteCv.wait(lock, [this]() { return _remoteHead != nullptr; });
+
+        RingAsyncTask* head = _remoteHead;
+        RingAsyncTask* tail = _remoteTail;
+        _remoteHead = nullptr;
+        _remoteTail = nullptr;
+        _remotePending.store(false, std::memory_order_relaxed);
+        lock.unlock();
+
+        if (head == nullptr)
+            return;
+
+        for (RingAsyncTask* task = head; task != nullptr; task = task->next)
+            _remotePosts++;
+
+        if (_localTail != nullptr)
+            _localTail->next = head;
+        else
+            _localHead = head;
+        _localTail = tail;
+    }
+
+private:
+    //   
+    RingAsyncTask* _localHead = nullptr;
+    RingAsyncTask* _localTail = nullptr;
+    size_t _liveTasks = 0;
+    uint64_t _runCount = 0;
+    uint64_t _remotePosts = 0;
+
+    // ٸ 忡  ۾ - _remotePending      Ȯ
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<bool> _remotePending{ false };
+    std::mutex _remoteMutex;
+    std::condition_variable _remoteCv;
+    RingAsyncTask* _remoteHead = nullptr;
+    RingAsyncTask* _remoteTail = nullptr;
+};
@@ -0,0 +1,375 @@
+//
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+#include "RingBuffer.h"
+
+// DrainAll    
+enum class FanInDrainOrder
+{
+    RoundRobin,     //  DRAIN_BURST ư (  Ź Ű  ڰ  )
+    Occupancy,      // Ͱ     DRAIN_BURST (   ڸ  Ǯ)
+    Sequence,       // Enqueue      (  ü  ʿ )
+};
+
+//   /  Һ fan-in -  帶  SPSC  ξ ڳ /ĳ   
+//  尡 ó Enqueue   ϳ ް (ϸ mutex), Ŀ thread_local ĳ÷ ٷ ã
+// Һڴ DrainAll(callback)     ޽ FanInDrainOrder  
+//
+// ޽ = CRingBufferT ޽ API  ([uint32_t ][]), ݹ鿡  
+// Sequence 忡  տ uint64_t   -  īʹ  ü ϹǷ ׸ŭ  
+//
+// Enqueue   忡, DrainAll/GetDataSize  Һ 忡 ȣ
+//   id ̹Ƿ   id      ̾  ( ڴ ϳ)
+template<typename IndexPolicy = PowerOfTwoIndex>
+class CRingFanInT
+{
+public:
+    using RingType = CRingBufferT<SpscLock, IndexPolicy>;
+
+    static constexpr size_t DRAIN_BURST = 64;   //     ִ ޽  (RoundRobin/Occupancy)
+    static constexpr size_t SEQUENCE_SIZE = sizeof(uint64_t);
+
+    explicit CRingFanInT(size_t capacityPerProducer = 65536, int maxProducers = 64, FanInDrainOrder order = FanInDrainOrder::RoundRobin)
+        : _instanceId(NextInstanceId().fetch_add(1, std::memory_order_relaxed) + 1)
+        , _capacityPerProducer(capacityPerProducer)
+        , _maxProducers(maxProducers > 0 ? maxProducers : 0)
+        , _order(order)
+        , _rings(new (std::nothrow) std::unique_ptr<RingType>[_maxProducers])
+        , _owners(_maxProducers)
+        , _producerCount(0)
+        , _sequence(0)
+        , _nextRing(0)
+        , _nextSequence(0)
+        , _scratch(capacityPerProducer)
+    {
+    }
+
+    CRingFanInT(const CRingFanInT&) = delete;
+    CRingFanInT& operator=(const CRingFanInT&) = delete;
+
+    bool IsValid() const
+    {
+        return _rings != nullptr && _maxProducers > 0 && IndexPolicy::IsValidCapacity(_capacityPerProducer);
+    }
+
+    // ===   ===
+
+    // ȣ   ޽ ϳ .   size
+    //   áų,   maxProducers Ѿų,  Ҵ翡 ϸ 0 (All-or-Nothing)
+    size_t Enqueue(const void* data, size_t size)
+    {
+        if (data == nullptr || size == 0)
+            return 0;
+
+        RingType* ring = AcquireRing();
+        if (ring == nullptr)
+            return 0;
+
+        if (_order != FanInDrainOrder::Sequence)
+            return ring->EnqueueMessage(data, size);
+
+        //   Ȯ   -     Һ  ߱ 
+        //   ڴ ȣ ̹Ƿ, ⼭ Ȯ   Һڰ ø⸸ 
+        size_t bodySize = SEQUENCE_SIZE + size;
+        if (bodySize > UINT32_MAX || ring->GetFreeSize() < RingType::MESSAGE_HEADER_SIZE + bodySize)
+            return 0;
+
+        uint32_t header = static_cast<uint32_t>(bodySize);
+        uint64_t sequence = _sequence.fetch_add(1, std::memory_order_relaxed);
+
+        RingIoVec vec[3];
+        vec[0].iov_base = &header;
+        vec[0].iov_len = RingType::MESSAGE_HEADER_SIZE;
+        vec[1].iov_base = &sequence;
+        vec[1].iov_len = SEQUENCE_SIZE;
+        vec[2].iov_base = const_cast<void*>(data);
+        vec[2].iov_len = size;
+
+        //  +  +     -> ޽ API(PeekMessageSpan/ConsumeMessage) ״ 
+        return ring->EnqueueV(vec, 3) != 0 ? size : 0;
+    }
+
+    // === Һ  ===
+
+    //    ִ maxMessages  callback(const void* data, size_t size) .   ȯ
+    // data ݹ ȿ ȿ ( θ  Űų, wrap  ģ ޽  ۿ  )
+    // Sequence :     ʾ (  ڰ  ) ű⼭ 
+    template<typename Callback>
+    size_t DrainAll(Callback&& callback, size_t maxMessages = SIZE_MAX)
+    {
+        int count = _producerCount.load(std::memory_order_acquire);
+        if (count == 0 || maxMessages == 0)
+            return 0;
+
+        switch (_order)
+        {
+        case FanInDrainOrder::Occupancy:
+            return DrainByOccupancy(count, callback, maxMessages);
+        case FanInDrainOrder::Sequence:
+            return DrainBySequence(count, callback, maxMessages);
+        default:
+            return DrainRoundRobin(count, callback, maxMessages);
+        }
+    }
+
+    //    Ʈ  (޽  ) - Ƽ忡 Ʈ 
+    size_t GetDataSize() const
+    {
+        size_t total = 0;
+        int count = _producerCount.load(std::memory_order_acquire);
+        for (int i = 0; i < count; i++)
+            total += _rings[i]->GetDataSize();
+        return total;
+    }
+
+    int GetProducerCount() const
+    {
+        return _producerCount.load(std::memory_order_acquire);
+    }
+
+    FanInDrainOrder GetDrainOrder() const
+    {
+        return _order;
+    }
+
+private:
+    // νϽ ּҴ   Ƿ thread_local ĳô   id 
+    static std::atomic<uint64_t>& NextInstanceId()
+    {
+        static std::atomic<uint64_t> s_nextId(0);
+        return s_nextId;
+    }
+
+    // ȣ   -   νϽ ϳ ĳ ( fan-in    ǥ ٽ ã)
+    RingType* AcquireRing()
+    {
+        struct TlsCache
+        {
+            uint64_t instanceId;
+            RingType* ring;
+        };
+        static thread_local TlsCache cache = { 0, nullptr };
+
+        if (cache.instanceId == _instanceId)
+            return cache.ring;
+
+        if (_rings == nullptr)
+            return nullptr;
+
+        std::thread::id self = std::this_thread::get_id();
+        RingType* ring = nullptr;
+
+        _registerLock.lock();
+
+        int count = _producerCount.load(std::memory_order_relaxed);
+        for (int i = 0; i < count; i++)
+        {
+            if (_owners[i] == self)
+            {
+                ring = _rings[i].get();
+                break;
+            }
+        }
+
+        if (ring == nullptr && count < _maxProducers)
+        {
+            std::unique_ptr<RingType> newRing(new (std::nothrow) RingType(_capacityPerProducer));
+            if (newRing != nullptr && newRing->IsValid())
+            {
+                ring = newRing.get();
+                _rings[count] = std::move(newRing);
+                _owners[count] = self;
+
+                // release:    ڿ Һڿ 
+                _producerCount.store(count + 1, std::memory_order_release);
+            }
+        }
+
+        _registerLock.unlock();
+
+        if (ring != nullptr)
+            cache = { _instanceId, ring };
+        return ring;
+    }
+
+    template<typename Callback>
+    size_t DrainRoundRobin(int count, Callback& callback, size_t maxMessages)
+    {
+        size_t delivered = 0;
+        bool progress = true;
+
+        while (progress && delivered < maxMessages)
+        {
+            progress = false;
+            for (int i = 0; i < count && delivered < maxMessages; i++)
+            {
+                int index = (_nextRing + i) % count;
+                size_t drained = DrainRing(*_rings[index], callback, (std::min)(DRAIN_BURST, maxMessages - delivered));
+                delivered += drained;
+                progress = progress || drained > 0;
+            }
+            _nextRing = (_nextRing + 1) % count;
+        }
+
+        return delivered;
+    }
+
+    template<typename Callback>
+    size_t DrainByOccupancy(int count, Callback& callback, size_t maxMessages)
+    {
+        size_t delivered = 0;
+
+        while (delivered < maxMessages)
+        {
+            int fullest = -1;
+            size_t fullestSize = 0;
+            for (int i = 0; i < count; i++)
+            {
+                size_t dataSize = _rings[i]->GetDataSize();
+                if (dataSize > fullestSize)
+                {
+                    fullest = i;
+                    fullestSize = dataSize;
+                }
+            }
+
+            if (fullest < 0)
+                break;
+
+            size_t drained = DrainRing(*_rings[fullest], callback, (std::min)(DRAIN_BURST, maxMessages - delivered));
+            if (drained == 0)
+                break;
+            delivered += drained;
+        }
+
+        return delivered;
+    }
+
+    //   ȿ  ϹǷ,       տ   
+    //    Ȯ  ڰ     ϳ  Ѿ
+    template<typename Callback>
+    size_t DrainBySequence(int count, Callback& callback, size_t maxMessages)
+    {
+        size_t delivered = 0;
+
+        while (delivered < maxMessages)
+        {
+            bool found = false;
+            for (int i = 0; i < count; i++)
+            {
+                int index = (_nextRing + i) % count;
+                RingSpans spans = _rings[index]->PeekMessageSpan();
+                if (spans.count == 0)
+                    continue;
+
+                uint64_t sequence = 0;
+                CopySpans(spans, 0, &sequence, SEQUENCE_SIZE);
+                if (sequence != _nextSequence)
+                    continue;
+
+                Deliver(spans, SEQUENCE_SIZE, callback);
+                _rings[index]->ConsumeMessage();
+                _nextSequence++;
+                _nextRing = index;
+                found = true;
+                break;
+            }
+
+            if (!found)
+                break;
+            delivered++;
+        }
+
+        return delivered;
+    }
+
+    template<typename Callback>
+    size_t DrainRing(RingType& ring, Callback& callback, size_t maxMessages)
+    {
+        size_t delivered = 0;
+        while (delivered < maxMessages)
+        {
+            RingSpans spans = ring.PeekMessageSpan();
+            if (spans.count == 0)
+                break;
+
+            Deliver(spans, 0, callback);
+            ring.ConsumeMessage();
+            delivered++;
+        }
+        return delivered;
+    }
+
+    //  skip ĸ ݹ鿡  -   ȿ   θ ״, wrap  ġ  ۿ Ƽ
+    template<typename Callback>
+    void Deliver(const RingSpans& spans, size_t skip, Callback& callback)
+    {
+        size_t size = spans.totalSize - skip;
+        size_t firstSize = spans.vec[0].iov_len;
+
+        if (skip + size <= firstSize)
+        {
+            callback(static_cast<const char*>(spans.vec[0].iov_base) + skip, size);
+        }
+        else if (skip >= firstSize)
+        {
+            callback(static_cast<const char*>(spans.vec[1].iov_base) + (skip - firstSize), size);
+        }
+        else
+        {
+            CopySpans(spans, skip, _scratch.data(), size);
+            callback(static_cast<const char*>(_scratch.data()), size);
+        }
+    }
+
+    //  ̾   [skip, skip + size) dst 
+    static void CopySpans(const RingSpans& spans, size_t skip, void* dst, size_t size)
+    {
+        char* out = static_cast<char*>(dst);
+        for (int i = 0; i < spans.count && size > 0; i++)
+        {
+            size_t length = spans.vec[i].iov_len;
+            if (skip >= length)
+            {
+                skip -= length;
+                continue;
+            }
+
+            size_t copySize = (std::min)(size, length - skip);
+            std::memcpy(out, static_cast<const char*>(spans.vec[i].iov_base) + skip, copySize);
+            out += copySize;
+            size -= copySize;
+            skip = 0;
+        }
+    }
+
+private:
+    const uint64_t _instanceId;
+    const size_t _capacityPerProducer;
+    const int _maxProducers;
+    const FanInDrainOrder _order;
+
+    //  ǥ -    Ǹ fan-in Ҹ  
+    std::unique_ptr<std::unique_ptr<RingType>[]> _rings;
+    std::vector<std::thread::id> _owners;
+    std::mutex _registerLock;
+    std::atomic<int> _producerCount;
+
+    //  : Sequence  
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) std::atomic<uint64_t> _sequence;
+
+    // Һ  
+    alignas(RINGBUFFER_CACHE_LINE_SIZE) int _nextRing;
+    uint64_t _nextSequence;
+    std::vector<char> _scratch;     // wrap  ģ ޽   (  뷮  )
+};
+
+// === Type Aliases ( Ǽ) ===
+using CRingFanIn = CRingFanInT<PowerOfTwoIndex>;
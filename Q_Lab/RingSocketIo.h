@@ -0,0 +1,151 @@
+//
+#pragma once
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+
+// winsock2.h windows.h  ;  - windows.h(WIN32_LEAN_AND_MEAN ) winsock.h  winsock2.h 浹
+//   RingBuffer.h / MemoryPool.h / windows.h  include ϰų winsock2.h   include  
+#if defined(_WIN32)
+#if defined(_WINSOCKAPI_) && !defined(_WINSOCK2API_)
+#error "RingSocketIo.h: winsock.h ̹ Ե - RingSocketIo.h(Ǵ winsock2.h) windows.h  include  "
+#endif
+#include <winsock2.h>
+#pragma comment(lib, "Ws2_32.lib")
+#else
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#include "RingBuffer.h"
+
+//  <->  
+//   / (wrap  ִ 2) ״ readv/writev(Windows: WSARecv/WSASend) ѱ
+// ӽ   , wrap ĵ ý  1 äų 
+//   API(ReserveWrite/CommitWrite, PeekSpans/Consume) ϹǷ RingBuffer.h    
+//
+// ȯ: ű Ʈ  / 0 = 밡  (RingRecvFrom) Ǵ   (RingSendTo, ý  )
+//       -1 =  (errno / WSAGetLastError, ŷ ̸ EAGAIN/WSAEWOULDBLOCK )
+//       RingRecvFrom     ý   -1, ENOBUFS (WSAENOBUFS)
+// 밡  Ͽ RingSendToϸ SIGPIPE  -1, EPIPE (Linux: sendmsg + MSG_NOSIGNAL, macOS: SO_NOSIGPIPE)
+//
+// RingRecvFrom ReserveWrite~CommitWrite (  ä) ý  ϹǷ  å ִ  ŷ   
+// RingSendTo PeekSpans~Consume ̿   Ƿ Һڰ ̸ ȣڰ ȭؾ 
+// SpscLock̸ RingRecvFrom , RingSendTo Һ 忡 ȣ (ŷ ϵ )
+// ޴  ʹ Ʈ Ʈ̹Ƿ ޽/ڵ API     (̹ ȣ )
+//  忡 ۸ Ű ʰ    
+
+// ( ũ) Ÿ
+#if defined(_WIN32)
+using RingSocket = SOCKET;
+#else
+using RingSocket = int;
+#endif
+
+// ý  1 - spans ִ 2 
+inline int64_t RingRecvIntoSpans(RingSocket fd, const RingSpans& spans)
+{
+#if defined(_WIN32)
+    WSABUF buffers[2];
+    for (int i = 0; i < spans.count; i++)
+    {
+        buffers[i].buf = static_cast<char*>(spans.vec[i].iov_base);
+        buffers[i].len = static_cast<ULONG>((std::min)(spans.vec[i].iov_len, static_cast<size_t>(ULONG_MAX)));
+    }
+
+    DWORD received = 0;
+    DWORD flags = 0;
+    if (WSARecv(fd, buffers, static_cast<DWORD>(spans.count), &received, &flags, nullptr, nullptr) == SOCKET_ERROR)
+        return -1;
+    return static_cast<int64_t>(received);
+#else
+    iovec buffers[2];
+    for (int i = 0; i < spans.count; i++)
+    {
+        buffers[i].iov_base = spans.vec[i].iov_base;
+        buffers[i].iov_len = spans.vec[i].iov_len;
+    }
+    return static_cast<int64_t>(readv(fd, buffers, spans.count));
+#endif
+}
+
+inline int64_t RingSendFromSpans(RingSocket fd, const RingSpans& spans)
+{
+#if defined(_WIN32)
+    WSABUF buffers[2];
+    for (int i = 0; i < spans.count; i++)
+    {
+        buffers[i].buf = static_cast<char*>(spans.vec[i].iov_base);
+        buffers[i].len = static_cast<ULONG>((std::min)(spans.vec[i].iov_len, static_cast<size_t>(ULONG_MAX)));
+    }
+
+    DWORD sent = 0;
+    if (WSASend(fd, buffers, static_cast<DWORD>(spans.count), &sent, 0, nullptr, nullptr) == SOCKET_ERROR)
+        return -1;
+    return static_cast<int64_t>(sent);
+#else
+    iovec buffers[2];
+    for (int i = 0; i < spans.count; i++)
+    {
+        buffers[i].iov_base = spans.vec[i].iov_base;
+        buffers[i].iov_len = spans.vec[i].iov_len;
+    }
+#if defined(__linux__)
+    // writev  밡 ݾ  μ ̴ SIGPIPE  EPIPE 
+    msghdr message = {};
+    message.msg_iov = buffers;
+    message.msg_iovlen = static_cast<size_t>(spans.count);
+    return static_cast<int64_t>(sendmsg(fd, &message, MSG_NOSIGNAL));
+#else
+#if defined(__APPLE__)
+    // macOS MSG_NOSIGNAL Ƿ  ɼ  (̹     ٽ )
+    int noSigPipe = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+    return static_cast<int64_t>(writev(fd, buffers, spans.count));
+#endif
+#endif
+}
+
+// Ͽ   ִ ŭ    ٷ 
+// ڰ ̸   Ȯΰ  ̿ ٸ ڰ Ἥ ENOBUFS    (   ó)
+template<typename RingType>
+int64_t RingRecvFrom(RingType& ring, RingSocket fd)
+{
+    size_t freeSize = ring.GetFreeSize();
+    RingSpans spans = {};
+    if (freeSize > 0)
+        spans = ring.ReserveWrite(freeSize);
+
+    if (spans.count == 0)
+    {
+#if defined(_WIN32)
+        WSASetLastError(WSAENOBUFS);
+#else
+        errno = ENOBUFS;
+#endif
+        return -1;
+    }
+
+    int64_t received = RingRecvIntoSpans(fd, spans);
+
+    // 0 ( /)  
+    ring.CommitWrite(received > 0 ? static_cast<size_t>(received) : 0);
+    return received;
+}
+
+//  ͸   ִ ŭ   ŭ Һ (κ ̸   )
+template<typename RingType>
+int64_t RingSendTo(RingType& ring, RingSocket fd)
+{
+    RingSpans spans = ring.PeekSpans();
+    if (spans.count == 0)
+        return 0;
+
+    int64_t sent = RingSendFromSpans(fd, spans);
+    if (sent > 0)
+        ring.Consume(static_cast<size_t>(sent));
+    return sent;
+}
@@ -0,0 +1,274 @@
+//
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <new>
+#include <string>
+#include <type_traits>
+#include "RingBuffer.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+// μ    ִ  å -  ޸    ϴ å
+// MutexLock(std::mutex), AdaptiveLock(μ  futex) ٸ μ ȭ 
+template<typename LockPolicy> struct IsProcessSharedLock : std::false_type {};
+template<> struct IsProcessSharedLock<SpscLock> : std::true_type {};
+template<> struct IsProcessSharedLock<SpinLock> : std::true_type {};
+template<> struct IsProcessSharedLock<TicketLock> : std::true_type {};
+
+// ̸ ִ  ޸ ׸Ʈ CRingBufferT   ȣƮ μ Ʈ ְ
+// (Linux: shm_open + mmap, Windows: ̸ ִ   )
+//
+// ׸Ʈ = [][ ü][]
+//  SharedMemoryStorage ϹǷ  ġ  ּ    -> μ  ּҰ ޶ 
+// Ŀ/ ׸Ʈ   ̹Ƿ Enqueue/Dequeue  ο ý  
+//
+//  Create, ٸ   ̸ Open   Get()   ״ 
+// ŷ API(EnqueueWait/DequeueWait) WaitPolicy = BlockingWait   
+//  ī/ ּҰ ׸Ʈ ȿ ְ  futex Ƿ ٸ μ Enqueue/Dequeue 
+// (Windows WaitOnAddress μ ȿ Ƿ 1ms ֱ ٽ Ȯ)
+// ڷƾ API(AsyncEnqueue/AsyncDequeue)   μ  Ͷ  Ұ ( )
+template<typename LockPolicy = SpscLock, typename IndexPolicy = PowerOfTwoIndex, typename WaitPolicy = NoWait>
+class CSharedMemoryRingT
+{
+public:
+    using RingType = CRingBufferT<LockPolicy, IndexPolicy, SharedMemoryStorage, PlainCopy, NoLatencyTrace, WaitPolicy>;
+
+    static_assert(IsProcessSharedLock<LockPolicy>::value, "μ   Ұ  å");
+    static_assert(std::atomic<typename IndexPolicy::Cursor>::is_always_lock_free, "Ŀ   lock-free ƴϸ μ   Ұ");
+
+    CSharedMemoryRingT()
+        : _segment(nullptr)
+        , _segmentSize(0)
+        , _ring(nullptr)
+        , _owner(false)
+#if defined(_WIN32)
+        , _mapping(nullptr)
+#endif
+    {
+    }
+
+    ~CSharedMemoryRingT()
+    {
+        Close();
+    }
+
+    CSharedMemoryRingT(const CSharedMemoryRingT&) = delete;
+    CSharedMemoryRingT& operator=(const CSharedMemoryRingT&) = delete;
+
+    //  ׸Ʈ   .  ̸ ׸Ʈ ̹  
+    // Linux name '/' ؾ  (: "/q_lab_ring")
+    bool Create(const char* name, size_t capacity)
+    {
+        if (_segment != nullptr || name == nullptr || !IndexPolicy::IsValidCapacity(capacity))
+            return false;
+
+        size_t segmentSize = RingOffset() + RingType::GetInPlaceSize(capacity);
+        if (!MapSegment(name, segmentSize, true))
+            return false;
+
+        _owner = true;
+        _name = name;
+
+        Header* header = new (_segment) Header();
+        header->magic = SEGMENT_MAGIC;
+        header->ringSize = static_cast<uint32_t>(sizeof(RingType));
+        header->capacity = capacity;
+
+        _ring = new (_segment + RingOffset()) RingType(capacity);
+
+        //    ڿ  - Open  ready acquire Ȯ
+        header->ready.store(1, std::memory_order_release);
+        return true;
+    }
+
+    // ٸ μ  ׸Ʈ . ų   ̰ų  ٸ 
+    bool Open(const char* name)
+    {
+        if (_segment != nullptr || name == nullptr)
+            return false;
+
+        if (!MapSegment(name, 0, false))
+            return false;
+
+        Header* header = reinterpret_cast<Header*>(_segment);
+        if (_segmentSize < RingOffset()
+            || header->ready.load(std::memory_order_acquire) != 1
+            || header->magic != SEGMENT_MAGIC
+            || header->ringSize != sizeof(RingType)
+            || _segmentSize < RingOffset() + RingType::GetInPlaceSize(static_cast<size_t>(header->capacity)))
+        {
+            UnmapSegment();
+            return false;
+        }
+
+        _ring = reinterpret_cast<RingType*>(_segment + RingOffset());
+        return true;
+    }
+
+    //  ,  ̸ ̸  (̹  μ  )
+    void Close()
+    {
+        if (_segment == nullptr)
+            return;
+
+        if (_owner)
+        {
+            _ring->~RingType();
+#if defined(__linux__)
+            shm_unlink(_name.c_str());
+#endif
+        }
+
+        UnmapSegment();
+        _ring = nullptr;
+        _owner = false;
+        _name.clear();
+    }
+
+    RingType* Get() const
+    {
+        return _ring;
+    }
+
+    bool IsValid() const
+    {
+        return _ring != nullptr;
+    }
+
+private:
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t ringSize;      // sizeof(RingType) - ø ڳ 尡 ٸ  Ǵ  
+        uint64_t capacity;
+        std::atomic<uint32_t> ready{ 0 };
+    };
+
+    static constexpr uint32_t SEGMENT_MAGIC = 0x474E4952; // "RING"
+
+    //  ü   ĳ  迡  (  alignas ǵ)
+    static constexpr size_t RingOffset()
+    {
+        return (sizeof(Header) + RINGBUFFER_CACHE_LINE_SIZE - 1) / RINGBUFFER_CACHE_LINE_SIZE * RINGBUFFER_CACHE_LINE_SIZE;
+    }
+
+    // create size ũ  , ƴϸ  ׸Ʈ ü 
+#if defined(_WIN32)
+    bool MapSegment(const char* name, size_t size, bool create)
+    {
+        if (create)
+        {
+            _mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                static_cast<DWORD>(static_cast<uint64_t>(size) >> 32), static_cast<DWORD>(size & 0xFFFFFFFF), name);
+            if (_mapping != nullptr && GetLastError() == ERROR_ALREADY_EXISTS)
+            {
+                CloseHandle(_mapping);
+                _mapping = nullptr;
+            }
+        }
+        else
+        {
+            _mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name);
+        }
+
+        if (_mapping == nullptr)
+            return false;
+
+        _segment = static_cast<char*>(MapViewOfFile(_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+        if (_segment == nullptr)
+        {
+            CloseHandle(_mapping);
+            _mapping = nullptr;
+            return false;
+        }
+
+        //    ũ⸦  ȸ  Ƿ  ũ⸦ 
+        MEMORY_BASIC_INFORMATION info = {};
+        VirtualQuery(_segment, &info, sizeof(info));
+        _segmentSize = create ? size : info.RegionSize;
+        return true;
+    }
+
+    void UnmapSegment()
+    {
+        UnmapViewOfFile(_segment);
+        CloseHandle(_mapping);
+        _mapping = nullptr;
+        _segment = nullptr;
+        _segmentSize = 0;
+    }
+#elif defined(__linux__)
+    bool MapSegment(const char* name, size_t size, bool create)
+    {
+        int fd = create ? shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600) : shm_open(name, O_RDWR, 0);
+        if (fd < 0)
+            return false;
+
+        if (create)
+        {
+            if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+            {
+                close(fd);
+                shm_unlink(name);
+                return false;
+            }
+        }
+        else
+        {
+            struct stat st = {};
+            if (fstat(fd, &st) != 0 || st.st_size <= 0)
+            {
+                close(fd);
+                return false;
+            }
+            size = static_cast<size_t>(st.st_size);
+        }
+
+        void* segment = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+        //   ޸ ü ϹǷ fd ٷ ݾƵ 
+        close(fd);
+
+        if (segment == MAP_FAILED)
+        {
+            if (create)
+                shm_unlink(name);
+            return false;
+        }
+
+        _segment = static_cast<char*>(segment);
+        _segmentSize = size;
+        return true;
+    }
+
+    void UnmapSegment()
+    {
+        munmap(_segment, _segmentSize);
+        _segment = nullptr;
+        _segmentSize = 0;
+    }
+#else
+    bool MapSegment(const char* /*name*/, size_t /*size*/, bool /*create*/) { return false; }
+    void UnmapSegment() {}
+#endif
+
+private:
+    char* _segment;
+    size_t _segmentSize;
+    RingType* _ring;
+    bool _owner;            // Create   - Close  ̸ 
+    std::string _name;
+#if defined(_WIN32)
+    HANDLE _mapping;
+#endif
+};
+
+// === Type Aliases ( Ǽ) ===
+using CSharedMemoryRingSPSC = CSharedMemoryRingT<SpscLock>;    // μ 1:1, lock-free
+using CSharedMemoryRingMT = CSharedMemoryRingT<SpinLock>;      // μ/ N:M,  ޸ ɶ
+using CSharedMemoryRingWaitSPSC = CSharedMemoryRingT<SpscLock, PowerOfTwoIndex, BlockingWait>;  // μ 1:1, EnqueueWait/DequeueWait